@@ -0,0 +1,85 @@
+/**
+ * @file    benchmark/calculus/activity.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the reverse sweep restricted to the active nodes.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing the derivative w.r.t. x of y = sum_k exp(-p_k^2) * cos(p_k) * sin(k x),
+ *          where the coefficients are subgraphs of the parameters p_k, which are not differentiated.
+ * @date    2023-07-28
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// Build the model with a given number of terms
+variable<double> model(const variable<double>& x, const std::vector<variable<double>>& p) {
+
+    variable<double> y = 0.0;
+    for (size_t k{}; k < p.size(); ++k)
+        y = y + op::exp(-op::square(p[k])) * op::cos(p[k]) * op::sin(static_cast<double>(k + 1) * x);
+
+    return y;
+
+}
+
+
+// Benchmark functions
+static void BM_ActiveSweep(benchmark::State& state) {
+
+    variable<double> x = 0.3;
+    std::vector<variable<double>> p;
+    for (int64_t k{}; k < state.range(0); ++k)
+        p.emplace_back(0.1 * k);
+
+    auto y = model(x, p);
+    const auto order = topological_order(y.expr.get());
+
+    for (auto _ : state) {
+        auto result = derivatives(y, wrt(x));
+        benchmark::DoNotOptimize(result);
+    }
+
+    // Check the result against the sweep over all the nodes
+    adjoint_buffer adjoints;
+    reverse_sweep(order, [&]() { y.expr->accumulate(1.0); });
+    if (std::abs(adjoints.value(x.expr.get()) - derivatives(y, wrt(x))) > 1e-12)
+        state.SkipWithError("Wrong derivative computed on the active nodes");
+
+    state.counters["nodes"] = order.size();
+    state.counters["active"] = active_nodes(y.expr.get(), {x.expr.get()}).size();
+
+}
+
+static void BM_FullSweep(benchmark::State& state) {
+
+    variable<double> x = 0.3;
+    std::vector<variable<double>> p;
+    for (int64_t k{}; k < state.range(0); ++k)
+        p.emplace_back(0.1 * k);
+
+    auto y = model(x, p);
+
+    for (auto _ : state) {
+        adjoint_buffer adjoints;
+        reverse_sweep(topological_order(y.expr.get()), [&]() { y.expr->accumulate(1.0); });
+        auto result = adjoints.value(x.expr.get());
+        benchmark::DoNotOptimize(result);
+    }
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_FullSweep)->RangeMultiplier(8)->Range(8, 1 << 12);
+BENCHMARK(BM_ActiveSweep)->RangeMultiplier(8)->Range(8, 1 << 12);
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,160 @@
+/**
+ * @file    benchmark/calculus/allocation.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the allocation of the expression nodes from a memory resource.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing the recording and the derivatives of a graph built and discarded at every iteration, by the global heap,
+ *          by the arena of the tape, by a monotonic buffer released after every graph and by a pool kept across the graphs.
+ *          The heap allocations of an iteration are counted by replacing the global operator new.
+ * @date    2023-08-03
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// The number of heap allocations
+static std::atomic<size_t> allocations{0};
+
+void* operator new(size_t bytes) {
+
+    ++allocations;
+    if (void* ptr = std::malloc(bytes ? bytes : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+
+}
+
+void* operator new(size_t bytes, std::align_val_t alignment) {
+
+    ++allocations;
+    const size_t align = static_cast<size_t>(alignment);
+    if (void* ptr = std::aligned_alloc(align, (std::max<size_t>(bytes, 1) + align - 1) / align * align))
+        return ptr;
+
+    throw std::bad_alloc();
+
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { std::free(ptr); }
+
+
+inline constexpr size_t steps = 1 << 10;
+
+
+// Build the graph of a particle falling with quadratic drag, and differentiate its final position
+auto fall() {
+
+    variable<double> x = 2.0, v = 0.0, dt = 1.0e-3, g = 9.81, l = 5.0;
+
+    variable<double> y = x, u = v;
+    for (size_t i{}; i < steps; ++i) {
+
+        u = u - (g + u * u / l) * dt;
+        y = y + u * dt;
+
+    }
+
+    return derivatives(y, wrt(x, v, g, l));
+
+}
+
+
+// Benchmark functions
+static void BM_Heap(benchmark::State& state) {
+
+    size_t count{};
+    for (auto _ : state) {
+
+        const size_t before = allocations.load();
+        benchmark::DoNotOptimize(fall());
+        count += allocations.load() - before;
+
+    }
+
+    state.counters["allocations"] = benchmark::Counter(count, benchmark::Counter::kAvgIterations);
+
+}
+
+static void BM_Arena(benchmark::State& state) {
+
+    size_t count{};
+    for (auto _ : state) {
+
+        const size_t before = allocations.load();
+        {
+            tape::scope recording;
+            benchmark::DoNotOptimize(fall());
+        }
+        count += allocations.load() - before;
+
+    }
+
+    state.counters["allocations"] = benchmark::Counter(count, benchmark::Counter::kAvgIterations);
+
+}
+
+static void BM_Monotonic(benchmark::State& state) {
+
+    std::pmr::monotonic_buffer_resource resource(1 << 20);
+
+    size_t count{};
+    for (auto _ : state) {
+
+        const size_t before = allocations.load();
+        {
+            tape::allocation scope(&resource);
+            benchmark::DoNotOptimize(fall());
+        }
+        resource.release();
+        count += allocations.load() - before;
+
+    }
+
+    state.counters["allocations"] = benchmark::Counter(count, benchmark::Counter::kAvgIterations);
+
+}
+
+static void BM_Pool(benchmark::State& state) {
+
+    std::pmr::unsynchronized_pool_resource resource;
+
+    size_t count{};
+    for (auto _ : state) {
+
+        const size_t before = allocations.load();
+        {
+            tape::allocation scope(&resource);
+            benchmark::DoNotOptimize(fall());
+        }
+        count += allocations.load() - before;
+
+    }
+
+    state.counters["allocations"] = benchmark::Counter(count, benchmark::Counter::kAvgIterations);
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_Heap)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Arena)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Monotonic)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Pool)->Unit(benchmark::kMicrosecond);
+
+// Run the benchmark
+BENCHMARK_MAIN();
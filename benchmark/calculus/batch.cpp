@@ -0,0 +1,122 @@
+/**
+ * @file    benchmark/calculus/batch.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the batched evaluation of the compiled programs.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing the value and the gradient of f(x, y) = exp(-(x^2 + y^2) / 2) sin(x y) + log(1 + x^2)
+ *          over a grid of points, with a scalar loop over variables, a scalar loop over the compiled program,
+ *          and the compiled program run on the whole batch in SIMD lanes.
+ * @date    2023-07-27
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// Build the model
+variable<double> model(const variable<double>& x, const variable<double>& y) {
+
+    return op::exp(-0.5 * (op::square(x) + op::square(y))) * op::sin(x * y) + op::log(1.0 + op::square(x));
+
+}
+
+
+// The points of the batch
+struct points {
+
+    std::vector<double> x, y, f, dfdx, dfdy;
+
+    points(size_t n) : x(n), y(n), f(n), dfdx(n), dfdy(n) {
+
+        for (size_t i{}; i < n; ++i) {
+            x[i] = -2.0 + 4.0 * i / n;
+            y[i] = 1.0 - 3.0 * i / n;
+        }
+
+    }
+
+};
+
+
+// Benchmark functions
+static void BM_BatchVariable(benchmark::State& state) {
+
+    points batch(state.range(0));
+
+    for (auto _ : state) {
+        for (size_t i{}; i < batch.x.size(); ++i) {
+            variable<double> x = batch.x[i], y = batch.y[i];
+            const auto f = model(x, y);
+            batch.f[i] = static_cast<double>(f);
+            std::tie(batch.dfdx[i], batch.dfdy[i]) = derivatives(f, wrt(x, y));
+        }
+        benchmark::DoNotOptimize(batch.dfdy.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+static void BM_BatchCompiledScalar(benchmark::State& state) {
+
+    points batch(state.range(0));
+
+    variable<double> x = 0.0, y = 0.0;
+    auto f = compile(model(x, y), wrt(x, y));
+
+    for (auto _ : state) {
+        for (size_t i{}; i < batch.x.size(); ++i) {
+            std::tie(batch.dfdx[i], batch.dfdy[i]) = f.gradient(batch.x[i], batch.y[i]);
+            batch.f[i] = f.prog.values[f.prog.output];
+        }
+        benchmark::DoNotOptimize(batch.dfdy.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+static void BM_BatchCompiled(benchmark::State& state) {
+
+    points batch(state.range(0));
+
+    variable<double> x = 0.0, y = 0.0;
+    auto f = compile(model(x, y), wrt(x, y));
+
+    for (auto _ : state) {
+        f.gradient(batch.f, {batch.dfdx, batch.dfdy}, batch.x, batch.y);
+        benchmark::DoNotOptimize(batch.dfdy.data());
+    }
+
+    // Check the batch against the scalar program
+    for (size_t i{}; i < batch.x.size(); ++i) {
+
+        const auto [dfdx, dfdy] = f.gradient(batch.x[i], batch.y[i]);
+        const double value = f.prog.values[f.prog.output];
+
+        if (std::abs(batch.f[i] - value) > 1e-12 || std::abs(batch.dfdx[i] - dfdx) > 1e-12 || std::abs(batch.dfdy[i] - dfdy) > 1e-12) {
+            state.SkipWithError("Wrong values computed in the batch");
+            break;
+        }
+
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_BatchVariable)->RangeMultiplier(8)->Range(8, 1 << 15);
+BENCHMARK(BM_BatchCompiledScalar)->RangeMultiplier(8)->Range(8, 1 << 15);
+BENCHMARK(BM_BatchCompiled)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,86 @@
+/**
+ * @file    benchmark/calculus/compile.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the compiled programs against rebuilding the graphs.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing a rk4 step of the hamiltonian H(q, p) = p^2 / 2 + sum_k cos(k q) / k^2, 
+ *          which needs the gradient of H at four points of the phase space.
+ * @date    2023-07-26
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// Build the hamiltonian with a given number of terms
+variable<double> hamiltonian(const variable<double>& q, const variable<double>& p, int64_t terms) {
+
+    variable<double> H = 0.5 * op::square(p);
+    for (int64_t k = 1; k <= terms; ++k)
+        H = H + op::cos(static_cast<double>(k) * q) / static_cast<double>(k * k);
+
+    return H;
+
+}
+
+
+// Take a rk4 step of the phase space, given the gradient of the hamiltonian
+template <typename GRADIENT>
+void rk4(double& q, double& p, double dt, GRADIENT&& gradient) {
+
+    const auto [dHdq1, dHdp1] = gradient(q, p);
+    const auto [dHdq2, dHdp2] = gradient(q + 0.5 * dt * dHdp1, p - 0.5 * dt * dHdq1);
+    const auto [dHdq3, dHdp3] = gradient(q + 0.5 * dt * dHdp2, p - 0.5 * dt * dHdq2);
+    const auto [dHdq4, dHdp4] = gradient(q + dt * dHdp3, p - dt * dHdq3);
+
+    q += dt / 6.0 * (dHdp1 + 2.0 * dHdp2 + 2.0 * dHdp3 + dHdp4);
+    p -= dt / 6.0 * (dHdq1 + 2.0 * dHdq2 + 2.0 * dHdq3 + dHdq4);
+
+}
+
+
+// Benchmark functions
+static void BM_RK4Rebuild(benchmark::State& state) {
+
+    double q = 0.1, p = 1.0;
+
+    for (auto _ : state) {
+        rk4(q, p, 0.01, [&](double q0, double p0) {
+            variable<double> qv = q0, pv = p0;
+            return derivatives(hamiltonian(qv, pv, state.range(0)), wrt(qv, pv));
+        });
+        benchmark::DoNotOptimize(q);
+    }
+
+}
+
+static void BM_RK4Compiled(benchmark::State& state) {
+
+    double q = 0.1, p = 1.0;
+
+    variable<double> qv = q, pv = p;
+    auto H = compile(hamiltonian(qv, pv, state.range(0)), wrt(qv, pv));
+
+    for (auto _ : state) {
+        rk4(q, p, 0.01, [&](double q0, double p0) { return H.gradient(q0, p0); });
+        benchmark::DoNotOptimize(q);
+    }
+
+    state.counters["slots"] = H.prog.code.size();
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_RK4Rebuild)->RangeMultiplier(4)->Range(1, 256);
+BENCHMARK(BM_RK4Compiled)->RangeMultiplier(4)->Range(1, 256);
+
+// Run the benchmark
+BENCHMARK_MAIN();
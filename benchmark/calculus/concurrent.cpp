@@ -0,0 +1,98 @@
+/**
+ * @file    benchmark/calculus/concurrent.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the stress benchmarking of derivatives called concurrently by many threads.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing y = sum_k p_k sin(p_k x) over a set of parameters p shared by all the threads:
+ *          every thread differentiates both a graph shared by all the threads and a graph of its own,
+ *          and checks the derivatives against dy/dp_k = sin(p_k x) + p_k x cos(p_k x).
+ * @date    2023-07-25
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+inline constexpr size_t terms = 256;
+
+
+// The parameters shared by all the threads
+const std::array<variable<double>, 4> params{0.5, 1.0, 1.5, 2.0};
+
+
+// Build the model at a given input
+variable<double> model(double x0) {
+
+    variable<double> y = 0.0;
+    for (size_t i{}; i < terms; ++i) {
+
+        const auto& p = params[i % params.size()];
+        y = y + p * op::sin(p * (x0 / terms));
+
+    }
+
+    return y;
+
+}
+
+
+// The graph shared by all the threads
+const variable<double> shared = model(1.0);
+
+
+// Check the derivatives of the model at a given input
+bool check(const std::tuple<double, double, double, double>& result, double x0) {
+
+    const auto [d0, d1, d2, d3] = result;
+    const std::array<double, 4> grad{d0, d1, d2, d3};
+
+    const double x = x0 / terms;
+
+    for (size_t k{}; k < params.size(); ++k) {
+
+        const double p = static_cast<double>(params[k]);
+        const double expected = (terms / params.size()) * (std::sin(p * x) + p * x * std::cos(p * x));
+
+        if (std::abs(grad[k] - expected) > 1e-12 * std::max(1.0, std::abs(expected)))
+            return false;
+
+    }
+
+    return true;
+
+}
+
+
+// Benchmark functions
+static void BM_ConcurrentDerivatives(benchmark::State& state) {
+
+    const double x0 = 1.0 + static_cast<double>(state.thread_index());
+    const auto own = model(x0);
+
+    for (auto _ : state) {
+
+        const auto shared_grad = derivatives(shared, wrt(params[0], params[1], params[2], params[3]));
+        const auto own_grad = derivatives(own, wrt(params[0], params[1], params[2], params[3]));
+
+        if (!check(shared_grad, 1.0) || !check(own_grad, x0)) {
+            state.SkipWithError("Wrong derivatives computed concurrently");
+            break;
+        }
+
+    }
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_ConcurrentDerivatives)->ThreadRange(1, 8)->UseRealTime();
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,86 @@
+/**
+ * @file    benchmark/calculus/deep.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the graphs of very long accumulations.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing the build, the derivative w.r.t. x and the destruction of y = sum_k sin(c_k x), with c_k = 1 + k % 7,
+ *          accumulated term by term in a chain as deep as the number of terms, or in a single sum node.
+ *          The largest graphs have 2^20 terms, more than a million, and are checked against the exact derivative.
+ * @date    2023-07-29
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// The exact derivative of the accumulation
+double exact(double x, int64_t n) {
+
+    double result{};
+    for (int64_t k{}; k < n; ++k)
+        result += (1.0 + k % 7) * std::cos((1.0 + k % 7) * x);
+
+    return result;
+
+}
+
+
+// Benchmark functions
+static void BM_Chain(benchmark::State& state) {
+
+    variable<double> x = 0.3;
+    double result{};
+
+    for (auto _ : state) {
+
+        variable<double> y = 0.0;
+        for (int64_t k{}; k < state.range(0); ++k)
+            y = y + op::sin((1.0 + k % 7) * x);
+
+        result = derivatives(y, wrt(x));
+        benchmark::DoNotOptimize(result);
+
+    }
+
+    if (std::abs(result - exact(0.3, state.range(0))) > 1e-6 * state.range(0))
+        state.SkipWithError("Wrong derivative computed on the chain");
+
+}
+
+static void BM_Sum(benchmark::State& state) {
+
+    variable<double> x = 0.3;
+    double result{};
+
+    for (auto _ : state) {
+
+        std::vector<expr_ptr<double>> terms;
+        terms.reserve(state.range(0));
+        for (int64_t k{}; k < state.range(0); ++k)
+            terms.push_back(op::sin((1.0 + k % 7) * x));
+
+        variable<double> y = op::sum(std::move(terms));
+        result = derivatives(y, wrt(x));
+        benchmark::DoNotOptimize(result);
+
+    }
+
+    if (std::abs(result - exact(0.3, state.range(0))) > 1e-6 * state.range(0))
+        state.SkipWithError("Wrong derivative computed on the sum node");
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_Chain)->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Sum)->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMillisecond);
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,108 @@
+/**
+ * @file    benchmark/calculus/derivatives.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the reverse mode automatic differentiation.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing derivatives on a deep chain of shared subexpressions y = x * x, z = y * y, ...
+ *          where every node is reachable by 2^depth paths.
+ * @date    2023-07-21
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// Build the chain of squares of given depth
+variable<double> chain(const variable<double>& x, int64_t depth) {
+
+    variable<double> y = x;
+    for (int64_t i{}; i < depth; ++i)
+        y = y * y;
+
+    return y;
+
+}
+
+
+// Propagate an adjoint recursing into each child, as the reverse mode did before the topological sweep:
+// every node is visited once per path, allocating the adjoint passed along every edge.
+// The chain only holds products, whose partial derivative w.r.t. a child is the value of the other one, and the leaf x.
+void propagate(expr_base* node, std::shared_ptr<double> wprime, double& grad, std::vector<expr_base*>& children) {
+
+    const auto begin = children.size();
+    node->children(children);
+    const auto end = children.size();
+
+    if (begin == end)
+        grad += *wprime;
+
+    for (auto i = begin; i < end; ++i) {
+        const auto other = static_cast<expr<double>*>(children[begin + end - 1 - i])->val;
+        propagate(children[i], std::make_shared<double>(*wprime * other), grad, children);
+    }
+
+    children.resize(begin);
+
+}
+
+
+// Benchmark functions
+static void BM_Derivatives(benchmark::State& state) {
+
+    variable<double> x = 1.0;
+    auto y = chain(x, state.range(0));
+
+    for (auto _ : state) {
+        auto result = derivatives(y, wrt(x));
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.counters["nodes"] = topological_order(y.expr.get()).size();
+
+}
+
+static void BM_RecursivePropagation(benchmark::State& state) {
+
+    variable<double> x = 1.0;
+    auto y = chain(x, state.range(0));
+    std::vector<expr_base*> children;
+
+    double grad{};
+    for (auto _ : state) {
+        grad = 0.0;
+        propagate(y.expr.get(), std::make_shared<double>(1.0), grad, children);
+        benchmark::DoNotOptimize(grad);
+    }
+
+    state.counters["paths"] = std::exp2(state.range(0));
+
+}
+
+static void BM_DerivativesOnTape(benchmark::State& state) {
+
+    variable<double> x = 1.0;
+
+    for (auto _ : state) {
+        tape::scope recording;
+        auto y = chain(x, state.range(0));
+        auto result = derivatives(y, wrt(x));
+        benchmark::DoNotOptimize(result);
+    }
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_Derivatives)->DenseRange(4, 20, 4);
+BENCHMARK(BM_RecursivePropagation)->DenseRange(4, 20, 4);
+BENCHMARK(BM_DerivativesOnTape)->DenseRange(4, 20, 4);
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,88 @@
+/**
+ * @file    benchmark/calculus/gradient.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the gradient w.r.t. a number of variables known at run time.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing the gradient w.r.t. the coefficients c_k of the least squares loss of the model f(t) = sum_k c_k sin(k t)
+ *          over some samples, computed by a single sweep into a buffer, or by a sweep for every coefficient.
+ * @date    2023-07-29
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// The least squares loss of the model over 16 samples of sin(t) / t
+variable<double> loss(const std::vector<variable<double>>& c) {
+
+    std::vector<expr_ptr<double>> residuals;
+    for (size_t i{}; i < 16; ++i) {
+
+        const double t = 0.1 + 0.2 * i;
+
+        std::vector<expr_ptr<double>> terms;
+        for (size_t k{}; k < c.size(); ++k)
+            terms.push_back(std::sin((k + 1) * t) * c[k].expr);
+
+        residuals.push_back(op::square(op::sum(std::move(terms)) - std::sin(t) / t));
+
+    }
+
+    return op::sum(std::move(residuals));
+
+}
+
+
+// Benchmark functions
+static void BM_Span(benchmark::State& state) {
+
+    std::vector<variable<double>> c;
+    for (int64_t k{}; k < state.range(0); ++k)
+        c.emplace_back(1.0 / (k + 1));
+
+    auto y = loss(c);
+    std::vector<double> grad(c.size());
+
+    for (auto _ : state) {
+        gradient(y, std::span(c), std::span(grad));
+        benchmark::DoNotOptimize(grad.data());
+    }
+
+    // Check the result against the derivatives w.r.t. one coefficient at a time
+    for (size_t k{}; k < c.size(); k += 7)
+        if (std::abs(grad[k] - derivatives(y, wrt(c[k]))) > 1e-12)
+            state.SkipWithError("Wrong gradient written in the buffer");
+
+}
+
+static void BM_PerVariable(benchmark::State& state) {
+
+    std::vector<variable<double>> c;
+    for (int64_t k{}; k < state.range(0); ++k)
+        c.emplace_back(1.0 / (k + 1));
+
+    auto y = loss(c);
+    std::vector<double> grad(c.size());
+
+    for (auto _ : state) {
+        for (size_t k{}; k < c.size(); ++k)
+            grad[k] = derivatives(y, wrt(c[k]));
+        benchmark::DoNotOptimize(grad.data());
+    }
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_Span)->RangeMultiplier(4)->Range(4, 1 << 10);
+BENCHMARK(BM_PerVariable)->RangeMultiplier(4)->Range(4, 1 << 10);
+
+// Run the benchmark
+BENCHMARK_MAIN();
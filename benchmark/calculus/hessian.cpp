@@ -0,0 +1,94 @@
+/**
+ * @file    benchmark/calculus/hessian.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the hessian-vector product.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing y = sum_i sin(x_i * x_{i+1}) for an increasing number of variables, 
+ *          against building the full hessian and multiplying it by the vector.
+ * @date    2023-07-23
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// Build the sum of the sines of the products of consecutive variables
+template <size_t N>
+variable<double> model(const std::array<variable<double>, N>& xs) {
+
+    variable<double> y = 0.0;
+    for (size_t i{}; i + 1 < N; ++i)
+        y = y + op::sin(xs[i] * xs[i + 1]);
+
+    return y;
+
+}
+
+
+// Benchmark functions
+template <size_t N>
+static void BM_HessianVectorProduct(benchmark::State& state) {
+
+    std::array<variable<double>, N> xs;
+    std::array<double, N> v;
+    for (size_t i{}; i < N; ++i) {
+        xs[i] = 0.1 * static_cast<double>(i + 1);
+        v[i] = 1.0;
+    }
+
+    const auto y = model(xs);
+
+    for (auto _ : state) {
+        auto result = std::apply([&](auto&... x) { return hessian_vector_product(y, wrt(x...), std::tuple_cat(v)); }, xs);
+        benchmark::DoNotOptimize(result);
+    }
+
+}
+
+template <size_t N>
+static void BM_HessianTimesVector(benchmark::State& state) {
+
+    std::array<variable<double>, N> xs;
+    std::array<double, N> v;
+    for (size_t i{}; i < N; ++i) {
+        xs[i] = 0.1 * static_cast<double>(i + 1);
+        v[i] = 1.0;
+    }
+
+    const auto y = model(xs);
+
+    for (auto _ : state) {
+
+        const auto H = std::apply([&](auto&... x) { return hessian(y, wrt(x...)); }, xs);
+
+        std::array<double, N> result{};
+        for (size_t j{}; j < N; ++j)
+            for (size_t i{}; i < N; ++i)
+                result[i] += H.data[j][i] * v[j];
+
+        benchmark::DoNotOptimize(result);
+
+    }
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_HessianVectorProduct<4>);
+BENCHMARK(BM_HessianTimesVector<4>);
+
+BENCHMARK(BM_HessianVectorProduct<16>);
+BENCHMARK(BM_HessianTimesVector<16>);
+
+BENCHMARK(BM_HessianVectorProduct<64>);
+BENCHMARK(BM_HessianTimesVector<64>);
+
+// Run the benchmark
+BENCHMARK_MAIN();
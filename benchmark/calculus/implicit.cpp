@@ -0,0 +1,65 @@
+/**
+ * @file    benchmark/calculus/implicit.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the implicit differentiation of a root solve.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing the derivatives w.r.t. a and b of the root of f(x) = x^3 + b x - a, 
+ *          found by N newton iterations recorded on the variables, or by solve_root.
+ * @date    2023-07-31
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// The function whose root is found
+auto f = [](const auto& x, const auto& a, const auto& b) { return x * x * x + b * x - a; };
+
+
+// Benchmark functions
+static void BM_Recorded(benchmark::State& state) {
+
+    const int64_t n = state.range(0);
+    variable<double> a = 2.0, b = 0.5;
+
+    for (auto _ : state) {
+
+        variable<double> x = 1.0;
+        for (int64_t k{}; k < n; ++k)
+            x = x - f(x, a, b) / (3.0 * x * x + b);
+
+        auto result = derivatives(x, wrt(a, b));
+        benchmark::DoNotOptimize(result);
+
+    }
+
+}
+
+static void BM_Implicit(benchmark::State& state) {
+
+    variable<double> a = 2.0, b = 0.5;
+
+    for (auto _ : state) {
+
+        variable<double> x = solve_root(f, interval<double>(0.0, 2.0), a, b);
+        auto result = derivatives(x, wrt(a, b));
+        benchmark::DoNotOptimize(result);
+
+    }
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_Recorded)->RangeMultiplier(2)->Range(4, 64);
+BENCHMARK(BM_Implicit);
+
+// Run the benchmark
+BENCHMARK_MAIN();
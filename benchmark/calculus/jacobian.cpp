@@ -0,0 +1,153 @@
+/**
+ * @file    benchmark/calculus/jacobian.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the jacobian in forward and reverse mode.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing a model with a hidden layer shared by all the outputs, h_k = sin(sum_j w_kj x_j) and
+ *          y_i = sum_k w_ik h_k, for a tall (2 -> 16) and a wide (16 -> 2) shape,
+ *          against calling derivatives once per output component, which the columns are checked against.
+ * @date    2023-07-22
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+inline constexpr size_t hidden = 16;
+
+
+// Return the weight connecting two units of the model
+constexpr double weight(size_t i, size_t j) noexcept {
+
+    return 0.01 * static_cast<double>((i + 1) * (j + 1));
+
+}
+
+
+// Build the outputs of the model from its inputs
+template <size_t M, size_t N>
+geometry::vector<variable<double>, M> model(const std::array<variable<double>, N>& xs) {
+
+    std::array<variable<double>, hidden> hs;
+    for (size_t k{}; k < hidden; ++k) {
+
+        variable<double> z = 0.0;
+        for (size_t j{}; j < N; ++j)
+            z = z + weight(k, j) * xs[j];
+
+        hs[k] = op::sin(z);
+
+    }
+
+    geometry::vector<variable<double>, M> ys;
+    for (size_t i{}; i < M; ++i) {
+
+        variable<double> y = 0.0;
+        for (size_t k{}; k < hidden; ++k)
+            y = y + weight(i, k) * hs[k];
+
+        ys.data[i] = y;
+
+    }
+
+    return ys;
+
+}
+
+
+// Compare the columns of a jacobian with the derivatives of every output
+template <size_t M, size_t N, typename COLUMNS>
+bool matches(const COLUMNS& columns, const geometry::vector<variable<double>, M>& ys, const std::array<variable<double>, N>& xs) {
+
+    bool same = true;
+    for (size_t i{}; i < M; ++i) {
+
+        const auto row = std::apply([&](auto&... x) { return derivatives(ys.data[i], wrt(x...)); }, xs);
+        meta::for_<N>([&](auto j) constexpr {
+            same = same && std::abs(std::get<j>(columns).data[i] - std::get<j>(row)) <= 1e-12;
+        });
+
+    }
+
+    return same;
+
+}
+
+
+// Benchmark functions
+template <size_t M, size_t N>
+static void BM_ForwardJacobian(benchmark::State& state) {
+
+    std::array<variable<double>, N> xs;
+    for (size_t j{}; j < N; ++j)
+        xs[j] = 0.1 * static_cast<double>(j + 1);
+
+    const auto ys = model<M>(xs);
+
+    auto result = std::apply([&](auto&... x) { return forward_jacobian(ys, wrt(x...)); }, xs);
+    for (auto _ : state) {
+        result = std::apply([&](auto&... x) { return forward_jacobian(ys, wrt(x...)); }, xs);
+        benchmark::DoNotOptimize(result);
+    }
+
+    if (!matches(result, ys, xs))
+        state.SkipWithError("Wrong jacobian in forward mode");
+
+}
+
+template <size_t M, size_t N>
+static void BM_ReverseJacobian(benchmark::State& state) {
+
+    std::array<variable<double>, N> xs;
+    for (size_t j{}; j < N; ++j)
+        xs[j] = 0.1 * static_cast<double>(j + 1);
+
+    const auto ys = model<M>(xs);
+
+    auto result = std::apply([&](auto&... x) { return reverse_jacobian(ys, wrt(x...)); }, xs);
+    for (auto _ : state) {
+        result = std::apply([&](auto&... x) { return reverse_jacobian(ys, wrt(x...)); }, xs);
+        benchmark::DoNotOptimize(result);
+    }
+
+    if (!matches(result, ys, xs))
+        state.SkipWithError("Wrong jacobian in reverse mode");
+
+}
+
+template <size_t M, size_t N>
+static void BM_DerivativesPerOutput(benchmark::State& state) {
+
+    std::array<variable<double>, N> xs;
+    for (size_t j{}; j < N; ++j)
+        xs[j] = 0.1 * static_cast<double>(j + 1);
+
+    const auto ys = model<M>(xs);
+
+    for (auto _ : state)
+        for (size_t i{}; i < M; ++i) {
+            auto result = std::apply([&](auto&... x) { return derivatives(ys.data[i], wrt(x...)); }, xs);
+            benchmark::DoNotOptimize(result);
+        }
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_ForwardJacobian<16, 2>);
+BENCHMARK(BM_ReverseJacobian<16, 2>);
+BENCHMARK(BM_DerivativesPerOutput<16, 2>);
+
+BENCHMARK(BM_ForwardJacobian<2, 16>);
+BENCHMARK(BM_ReverseJacobian<2, 16>);
+BENCHMARK(BM_DerivativesPerOutput<2, 16>);
+
+// Run the benchmark
+BENCHMARK_MAIN();
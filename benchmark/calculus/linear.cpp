@@ -0,0 +1,220 @@
+/**
+ * @file    benchmark/calculus/linear.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the matrix nodes of the determinant and of the solution of a linear system.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing the recording and the gradient w.r.t. a N x N matrix A of det(A), by the cofactor expansion over a scalar
+ *          node for every element, and of c . A^-1 b, by the gaussian elimination over scalar nodes, 
+ *          against the single determinant and solve nodes keeping the LU factorization of A. 
+ *          The number of nodes of the graph is reported.
+ * @date    2023-08-02
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+template <size_t N>
+using vector_t = geometry::column_vector<double, N>;
+
+template <size_t N>
+using matrix_t = geometry::matrix<vector_t<N>, N>;
+
+
+// A well conditioned matrix, with a dominant diagonal
+template <size_t N>
+matrix_t<N> matrix() {
+
+    matrix_t<N> A;
+    for (size_t j{}; j < N; ++j)
+        for (size_t i{}; i < N; ++i)
+            A.data[j].data[i] = (i == j) ? N + 1.0 : std::sin(1.0 + i + 2.0 * j);
+
+    return A;
+
+}
+
+template <size_t N>
+vector_t<N> vector(double shift) {
+
+    vector_t<N> b;
+    for (size_t i{}; i < N; ++i)
+        b.data[i] = std::cos(shift + i);
+
+    return b;
+
+}
+
+
+// The determinant by the cofactor expansion along the first column of the rows left
+expr_ptr<double> cofactor(const std::vector<variable<double>>& a, size_t n, size_t column, std::vector<size_t>& rows) {
+
+    if (column == n - 1)
+        return a[column * n + rows.front()].expr;
+
+    std::vector<expr_ptr<double>> terms;
+    for (size_t k{}; k < rows.size(); ++k) {
+
+        const size_t i = rows[k];
+        rows.erase(std::next(rows.begin(), k));
+        auto minor = a[column * n + i].expr * cofactor(a, n, column + 1, rows);
+        rows.insert(std::next(rows.begin(), k), i);
+
+        terms.push_back(k % 2 ? -minor : minor);
+
+    }
+
+    return op::sum(std::move(terms));
+
+}
+
+// The solution of A x = b by the gaussian elimination without pivoting, returning c . x
+expr_ptr<double> elimination(const std::vector<variable<double>>& a, size_t n, const std::vector<double>& b, const std::vector<double>& c) {
+
+    std::vector<expr_ptr<double>> m(n * n), x(n);
+    for (size_t j{}; j < n; ++j)
+        for (size_t i{}; i < n; ++i)
+            m[i * n + j] = a[j * n + i].expr;
+
+    for (size_t i{}; i < n; ++i)
+        x[i] = constant(b[i]);
+
+    for (size_t k{}; k < n; ++k)
+        for (size_t i = k + 1; i < n; ++i) {
+            const auto factor = m[i * n + k] / m[k * n + k];
+            for (size_t j = k + 1; j < n; ++j)
+                m[i * n + j] = m[i * n + j] - factor * m[k * n + j];
+            x[i] = x[i] - factor * x[k];
+        }
+
+    for (size_t i = n; i-- > 0; ) {
+        for (size_t j = i + 1; j < n; ++j)
+            x[i] = x[i] - m[i * n + j] * x[j];
+        x[i] = x[i] / m[i * n + i];
+    }
+
+    std::vector<expr_ptr<double>> terms;
+    for (size_t i{}; i < n; ++i)
+        terms.push_back(c[i] * x[i]);
+
+    return op::sum(std::move(terms));
+
+}
+
+
+template <size_t N>
+std::vector<variable<double>> elements() {
+
+    const auto A = matrix<N>();
+
+    std::vector<variable<double>> a;
+    for (size_t j{}; j < N; ++j)
+        for (size_t i{}; i < N; ++i)
+            a.emplace_back(A.data[j].data[i]);
+
+    return a;
+
+}
+
+
+// Benchmark functions
+template <size_t N>
+static void BM_DeterminantCofactor(benchmark::State& state) {
+
+    const auto a = elements<N>();
+    std::vector<double> grad(N * N);
+    size_t nodes{};
+
+    for (auto _ : state) {
+        std::vector<size_t> rows(N);
+        std::iota(rows.begin(), rows.end(), 0);
+        variable<double> y = cofactor(a, N, 0, rows);
+        gradient(y, std::span(a), std::span(grad));
+        benchmark::DoNotOptimize(grad.data());
+        nodes = topological_order(y.expr.get()).size();
+    }
+
+    state.counters["nodes"] = nodes;
+
+}
+
+template <size_t N>
+static void BM_DeterminantNode(benchmark::State& state) {
+
+    variable<matrix_t<N>> A(matrix<N>());
+    size_t nodes{};
+
+    for (auto _ : state) {
+        variable<double> y = op::determinant(A);
+        auto grad = derivatives(y, wrt(A));
+        benchmark::DoNotOptimize(grad);
+        nodes = topological_order(y.expr.get()).size();
+    }
+
+    state.counters["nodes"] = nodes;
+
+}
+
+template <size_t N>
+static void BM_SolveElimination(benchmark::State& state) {
+
+    const auto a = elements<N>();
+    const auto b = vector<N>(0.5), c = vector<N>(1.5);
+    const std::vector<double> bs(b.data.begin(), b.data.end()), cs(c.data.begin(), c.data.end());
+    std::vector<double> grad(N * N);
+    size_t nodes{};
+
+    for (auto _ : state) {
+        variable<double> y = elimination(a, N, bs, cs);
+        gradient(y, std::span(a), std::span(grad));
+        benchmark::DoNotOptimize(grad.data());
+        nodes = topological_order(y.expr.get()).size();
+    }
+
+    state.counters["nodes"] = nodes;
+
+}
+
+template <size_t N>
+static void BM_SolveNode(benchmark::State& state) {
+
+    variable<matrix_t<N>> A(matrix<N>());
+    const auto b = vector<N>(0.5), c = vector<N>(1.5);
+    size_t nodes{};
+
+    for (auto _ : state) {
+        variable<double> y = op::dot(c, op::solve(A, b));
+        auto grad = derivatives(y, wrt(A));
+        benchmark::DoNotOptimize(grad);
+        nodes = topological_order(y.expr.get()).size();
+    }
+
+    state.counters["nodes"] = nodes;
+
+}
+
+
+// Register the benchmarks
+BENCHMARK_TEMPLATE(BM_DeterminantCofactor, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_DeterminantCofactor, 5)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_DeterminantCofactor, 7)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_DeterminantNode, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_DeterminantNode, 5)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_DeterminantNode, 7)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_DeterminantNode, 16)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SolveElimination, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SolveElimination, 8)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SolveElimination, 16)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SolveNode, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SolveNode, 8)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SolveNode, 16)->Unit(benchmark::kMicrosecond);
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,109 @@
+/**
+ * @file    benchmark/calculus/parallel.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the reverse sweep of a wide graph over many threads.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing the gradient of the negative log likelihood of a gaussian model, summed over N samples
+ *          by a single node, w.r.t. its three parameters: by derivatives, by the serial sweep of the active nodes
+ *          sorted once, and by parallel_sweep over 1 to 32 threads, with the schedule built once out of the loop.
+ * @date    2023-08-01
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+inline constexpr size_t samples = 1 << 16;
+
+
+// The parameters of the model
+variable<double> a = 0.7, b = -0.3, s = 1.2;
+
+
+// Build the negative log likelihood of the samples
+variable<double> likelihood() {
+
+    std::vector<expr_ptr<double>> terms;
+    terms.reserve(samples);
+
+    for (size_t i{}; i < samples; ++i) {
+
+        const double x = static_cast<double>(i) / samples;
+        const double y = 0.7 * x - 0.3 + 0.1 * std::sin(1.0e3 * x);
+        terms.push_back(op::square((y - a * x - b) / s) * 0.5 + op::log(s));
+
+    }
+
+    return op::sum(std::move(terms));
+
+}
+
+const variable<double> nll = likelihood();
+
+
+// Benchmark functions
+static void BM_Serial(benchmark::State& state) {
+
+    for (auto _ : state) {
+
+        auto result = derivatives(nll, wrt(a, b, s));
+        benchmark::DoNotOptimize(result);
+
+    }
+
+}
+
+static void BM_Active(benchmark::State& state) {
+
+    const auto active = active_nodes(nll.expr.get(), wrt(a, b, s).nodes());
+
+    for (auto _ : state) {
+
+        adjoint_buffer adjoints;
+        active_sweep(active, [&]() { nll.expr->accumulate(1.0); });
+        benchmark::DoNotOptimize(adjoints.value(a.expr.get()));
+
+    }
+
+}
+
+static void BM_Parallel(benchmark::State& state) {
+
+    const parallel_schedule schedule({nll.expr.get()}, wrt(a, b, s).nodes(), state.range(0));
+
+    for (auto _ : state) {
+
+        auto result = derivatives(schedule, nll, wrt(a, b, s));
+        benchmark::DoNotOptimize(result);
+
+    }
+
+}
+
+static void BM_Schedule(benchmark::State& state) {
+
+    for (auto _ : state) {
+
+        parallel_schedule schedule({nll.expr.get()}, wrt(a, b, s).nodes(), state.range(0));
+        benchmark::DoNotOptimize(schedule);
+
+    }
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_Serial)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Active)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Parallel)->RangeMultiplier(2)->Range(1, 32)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Schedule)->Arg(8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,109 @@
+/**
+ * @file    benchmark/calculus/primitive.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the user-defined primitive nodes.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing the build and the derivative w.r.t. a of the laplace transform of a pulse, 
+ *          F(a) = int_0^1 exp(-a t) sin(3 t) dt, computed by the midpoint rule with N samples, 
+ *          recorded sample by sample or as a single primitive node with its derivative hand-written.
+ * @date    2023-07-30
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// The integral F(a) by the midpoint rule
+double laplace(double a, int64_t n) {
+
+    const double h = 1.0 / n;
+    double result{};
+    for (int64_t k{}; k < n; ++k) {
+        const double t = (k + 0.5) * h;
+        result += std::exp(-a * t) * std::sin(3.0 * t) * h;
+    }
+
+    return result;
+
+}
+
+// The derivative F'(a) by the midpoint rule
+double dlaplace(double a, int64_t n) {
+
+    const double h = 1.0 / n;
+    double result{};
+    for (int64_t k{}; k < n; ++k) {
+        const double t = (k + 0.5) * h;
+        result -= t * std::exp(-a * t) * std::sin(3.0 * t) * h;
+    }
+
+    return result;
+
+}
+
+
+// Benchmark functions
+static void BM_Recorded(benchmark::State& state) {
+
+    const int64_t n = state.range(0);
+    const double h = 1.0 / n;
+    variable<double> a = 0.7;
+    double result{};
+
+    for (auto _ : state) {
+
+        std::vector<expr_ptr<double>> terms;
+        for (int64_t k{}; k < n; ++k) {
+            const double t = (k + 0.5) * h;
+            terms.push_back(op::exp(-t * a.expr) * (std::sin(3.0 * t) * h));
+        }
+
+        variable<double> F = op::sum(std::move(terms));
+        result = derivatives(F, wrt(a));
+        benchmark::DoNotOptimize(result);
+
+    }
+
+    if (std::abs(result - dlaplace(0.7, n)) > 1e-12)
+        state.SkipWithError("Wrong derivative of the recorded integral");
+
+}
+
+static void BM_Primitive(benchmark::State& state) {
+
+    const int64_t n = state.range(0);
+    variable<double> a = 0.7;
+    double result{};
+
+    primitive F(
+        [n](double x) { return laplace(x, n); }, 
+        [n](double, double x) { return dlaplace(x, n); }
+    );
+
+    for (auto _ : state) {
+
+        variable<double> y = F(a);
+        result = derivatives(y, wrt(a));
+        benchmark::DoNotOptimize(result);
+
+    }
+
+    if (std::abs(result - dlaplace(0.7, n)) > 1e-12)
+        state.SkipWithError("Wrong derivative of the primitive integral");
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_Recorded)->RangeMultiplier(8)->Range(8, 1 << 12);
+BENCHMARK(BM_Primitive)->RangeMultiplier(8)->Range(8, 1 << 12);
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,156 @@
+/**
+ * @file    benchmark/calculus/products.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the vector-jacobian and of the jacobian-vector products.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing a model with a hidden layer shared by all the outputs, h_k = sin(sum_j w_kj x_j) and
+ *          y_i = sum_k w_ik h_k, with M outputs and 4 inputs: the vector-jacobian product is computed by a single sweep
+ *          against calling derivatives once per output component, and the jacobian-vector product by a single sweep
+ *          against the gradient of the outputs w.r.t. every input.
+ * @date    2023-07-29
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+inline constexpr size_t hidden = 64;
+
+
+// Return the weight connecting two units of the model
+constexpr double weight(size_t i, size_t j) noexcept {
+
+    return 0.01 * static_cast<double>((i + 1) * (j + 1));
+
+}
+
+
+// Build the outputs of the model from its inputs
+template <size_t M>
+geometry::vector<variable<double>, M> model(const std::array<variable<double>, 4>& xs) {
+
+    std::vector<expr_ptr<double>> hs;
+    for (size_t k{}; k < hidden; ++k) {
+
+        std::vector<expr_ptr<double>> zs;
+        for (size_t j{}; j < xs.size(); ++j)
+            zs.push_back(weight(k, j) * xs[j].expr);
+
+        hs.push_back(op::sin(op::sum(std::move(zs))));
+
+    }
+
+    geometry::vector<variable<double>, M> ys;
+    for (size_t i{}; i < M; ++i) {
+
+        std::vector<expr_ptr<double>> terms;
+        for (size_t k{}; k < hidden; ++k)
+            terms.push_back(weight(i, k) * hs[k]);
+
+        ys.data[i] = op::sum(std::move(terms));
+
+    }
+
+    return ys;
+
+}
+
+
+// Benchmark functions
+template <size_t M>
+static void BM_Vjp(benchmark::State& state) {
+
+    std::array<variable<double>, 4> xs{0.1, 0.2, 0.3, 0.4};
+    const auto ys = model<M>(xs);
+
+    geometry::vector<double, M> u;
+    for (size_t i{}; i < M; ++i)
+        u.data[i] = 1.0 / (i + 1);
+
+    for (auto _ : state) {
+        auto result = vjp(ys, u, wrt(xs[0], xs[1], xs[2], xs[3]));
+        benchmark::DoNotOptimize(result);
+    }
+
+    // Check the result against the derivatives of every output
+    double expected{};
+    for (size_t i{}; i < M; ++i)
+        expected += u.data[i] * derivatives(ys.data[i], wrt(xs[2]));
+
+    if (std::abs(std::get<2>(vjp(ys, u, wrt(xs[0], xs[1], xs[2], xs[3]))) - expected) > 1e-12)
+        state.SkipWithError("Wrong vector-jacobian product");
+
+}
+
+template <size_t M>
+static void BM_VjpPerOutput(benchmark::State& state) {
+
+    std::array<variable<double>, 4> xs{0.1, 0.2, 0.3, 0.4};
+    const auto ys = model<M>(xs);
+
+    for (auto _ : state) {
+        std::array<double, 4> result{};
+        for (size_t i{}; i < M; ++i) {
+            const auto [d0, d1, d2, d3] = derivatives(ys.data[i], wrt(xs[0], xs[1], xs[2], xs[3]));
+            result = {result[0] + d0 / (i + 1), result[1] + d1 / (i + 1), result[2] + d2 / (i + 1), result[3] + d3 / (i + 1)};
+        }
+        benchmark::DoNotOptimize(result);
+    }
+
+}
+
+template <size_t M>
+static void BM_Jvp(benchmark::State& state) {
+
+    std::array<variable<double>, 4> xs{0.1, 0.2, 0.3, 0.4};
+    const auto ys = model<M>(xs);
+
+    for (auto _ : state) {
+        auto result = jvp(ys, wrt(xs[0], xs[1], xs[2], xs[3]), std::tuple{1.0, -1.0, 0.5, 2.0});
+        benchmark::DoNotOptimize(result);
+    }
+
+    // Check the result against the gradient w.r.t. every input
+    const auto result = jvp(ys, wrt(xs[0], xs[1], xs[2], xs[3]), std::tuple{1.0, -1.0, 0.5, 2.0});
+    const auto expected = gradient(ys, xs[0]) - gradient(ys, xs[1]) + 0.5 * gradient(ys, xs[2]) + 2.0 * gradient(ys, xs[3]);
+
+    for (size_t i{}; i < M; ++i)
+        if (std::abs(result.data[i] - expected.data[i]) > 1e-12)
+            state.SkipWithError("Wrong jacobian-vector product");
+
+}
+
+template <size_t M>
+static void BM_JvpPerInput(benchmark::State& state) {
+
+    std::array<variable<double>, 4> xs{0.1, 0.2, 0.3, 0.4};
+    const auto ys = model<M>(xs);
+
+    for (auto _ : state) {
+        auto result = gradient(ys, xs[0]) - gradient(ys, xs[1]) + 0.5 * gradient(ys, xs[2]) + 2.0 * gradient(ys, xs[3]);
+        benchmark::DoNotOptimize(result);
+    }
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_Vjp<4>);
+BENCHMARK(BM_VjpPerOutput<4>);
+BENCHMARK(BM_Vjp<32>);
+BENCHMARK(BM_VjpPerOutput<32>);
+
+BENCHMARK(BM_Jvp<4>);
+BENCHMARK(BM_JvpPerInput<4>);
+BENCHMARK(BM_Jvp<32>);
+BENCHMARK(BM_JvpPerInput<32>);
+
+// Run the benchmark
+BENCHMARK_MAIN();
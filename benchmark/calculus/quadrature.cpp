@@ -0,0 +1,109 @@
+/**
+ * @file    benchmark/calculus/quadrature.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the parametric integrals.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing the build and the derivatives w.r.t. a and w of F(a, w) = int_0^1 exp(-a t) sin(w t) dt, 
+ *          computed by the midpoint rule with N samples, recorded sample by sample or as a single parametric node.
+ * @date    2023-07-31
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// The integrand
+auto f = [](const auto& t, const auto& a, const auto& w) { return op::exp(-a * t) * op::sin(w * t); };
+
+
+// The derivatives of F w.r.t. a and w by the midpoint rule
+std::array<double, 2> dintegral(double a, double w, size_t n) {
+
+    const double h = 1.0 / n;
+    std::array<double, 2> result{};
+    for (size_t k{}; k < n; ++k) {
+        const double t = (k + 0.5) * h;
+        result[0] -= t * std::exp(-a * t) * std::sin(w * t) * h;
+        result[1] += t * std::exp(-a * t) * std::cos(w * t) * h;
+    }
+
+    return result;
+
+}
+
+// Check the derivatives against the ones by the midpoint rule
+bool matches(const std::tuple<double, double>& result, size_t n) {
+
+    const auto [da, dw] = result;
+    const auto [ea, ew] = dintegral(0.7, 3.0, n);
+    return std::abs(da - ea) <= 1e-12 && std::abs(dw - ew) <= 1e-12;
+
+}
+
+
+// Benchmark functions
+template <size_t N>
+static void BM_Recorded(benchmark::State& state) {
+
+    const double h = 1.0 / N;
+    variable<double> a = 0.7, w = 3.0;
+    std::tuple<double, double> result;
+
+    for (auto _ : state) {
+
+        std::vector<expr_ptr<double>> terms;
+        for (size_t k{}; k < N; ++k) {
+            const double t = (k + 0.5) * h;
+            terms.push_back(op::exp(-t * a.expr) * op::sin(t * w.expr) * h);
+        }
+
+        variable<double> F = op::sum(std::move(terms));
+        result = derivatives(F, wrt(a, w));
+        benchmark::DoNotOptimize(result);
+
+    }
+
+    if (!matches(result, N))
+        state.SkipWithError("Wrong derivatives of the recorded integral");
+
+}
+
+template <size_t N>
+static void BM_Parametric(benchmark::State& state) {
+
+    variable<double> a = 0.7, w = 3.0;
+    std::tuple<double, double> result;
+
+    for (auto _ : state) {
+
+        variable<double> F = integrals::midpoint<N>(f, interval<double>(0.0, 1.0), a, w);
+        result = derivatives(F, wrt(a, w));
+        benchmark::DoNotOptimize(result);
+
+    }
+
+    if (!matches(result, N))
+        state.SkipWithError("Wrong derivatives of the parametric integral");
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_Recorded<8>);
+BENCHMARK(BM_Parametric<8>);
+BENCHMARK(BM_Recorded<64>);
+BENCHMARK(BM_Parametric<64>);
+BENCHMARK(BM_Recorded<512>);
+BENCHMARK(BM_Parametric<512>);
+BENCHMARK(BM_Recorded<4096>);
+BENCHMARK(BM_Parametric<4096>);
+
+// Run the benchmark
+BENCHMARK_MAIN();
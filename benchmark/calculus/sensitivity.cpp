@@ -0,0 +1,77 @@
+/**
+ * @file    benchmark/calculus/sensitivity.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the adjoint sensitivities of a time evolution.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing the derivatives of the final position of a pendulum, evolved by N symplectic euler steps, 
+ *          w.r.t. the initial phase space and the strength k, recording the whole trajectory 
+ *          or reversing it by adjoint_evolve with 16 snapshots.
+ * @date    2023-07-31
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+constexpr double dt = 0.01;
+
+// A symplectic euler step of the pendulum
+auto step = [](const std::tuple<variable<double>, variable<double>>& s, const variable<double>& k) {
+
+    const auto& [q, p] = s;
+    variable<double> p1 = p - dt * k * op::sin(q);
+    variable<double> q1 = q + dt * p1;
+
+    return std::make_tuple(q1, p1);
+
+};
+
+
+// Benchmark functions
+static void BM_Recorded(benchmark::State& state) {
+
+    const int64_t n = state.range(0);
+    variable<double> k = 2.0;
+
+    for (auto _ : state) {
+
+        variable<double> q0 = 1.0, p0 = 0.0;
+        std::tuple<variable<double>, variable<double>> s{q0, p0};
+        for (int64_t i{}; i < n; ++i)
+            s = step(s, k);
+
+        auto result = derivatives(std::get<0>(s), wrt(q0, p0, k));
+        benchmark::DoNotOptimize(result);
+
+    }
+
+}
+
+static void BM_Checkpointed(benchmark::State& state) {
+
+    const int64_t n = state.range(0);
+    variable<double> k = 2.0;
+
+    for (auto _ : state) {
+
+        auto result = adjoint_evolve(step, std::tuple{1.0, 0.0}, n, std::array<double, 2>{1.0, 0.0}, 16, k);
+        benchmark::DoNotOptimize(result);
+
+    }
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_Recorded)->RangeMultiplier(8)->Range(64, 1 << 15);
+BENCHMARK(BM_Checkpointed)->RangeMultiplier(8)->Range(64, 1 << 15);
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,218 @@
+/**
+ * @file    benchmark/calculus/simplify.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the simplification of the expression graphs while they are built.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing the build and the gradient of the hamiltonian of N particles in a plane,
+ *          H = sum_i 0.5 * (px_i^2 + py_i^2) + 0.5 * (x_i^2 + y_i^2) + 0.1 * (x_i^2 + y_i^2)^2,
+ *          where the squares are computed twice and the literals are repeated for every particle.
+ *          Testing then the energy of a chain of N masses joined by springs, as a physics formula is usually written,
+ *          E = sum_i 0.5 m v_i v_i + 0.5 k (x_i+1 - x_i - L) (x_i+1 - x_i - L), with m = 2, k = 3 and L = 1,
+ *          where the literals are repeated for every mass and the elongations are written twice.
+ *          The build and the gradient are timed together, then the gradient alone of a graph built once.
+ * @date    2023-07-28
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// The phase space of N particles in a plane
+struct phase_space {
+
+    std::vector<variable<double>> x, y, px, py;
+
+    phase_space(size_t n) {
+
+        for (size_t i{}; i < n; ++i) {
+            x.emplace_back(1.0 + 0.1 * i);
+            y.emplace_back(-0.5 + 0.2 * i);
+            px.emplace_back(0.3 * i);
+            py.emplace_back(1.0 - 0.1 * i);
+        }
+
+    }
+
+};
+
+
+// Build the hamiltonian
+variable<double> hamiltonian(const phase_space& s) {
+
+    variable<double> H = 0.0;
+    for (size_t i{}; i < s.x.size(); ++i) {
+        H = H + 0.5 * (op::square(s.px[i]) + op::square(s.py[i])) * 1.0;
+        H = H + 0.5 * (op::square(s.x[i]) + op::square(s.y[i])) + 0.0;
+        H = H + 0.1 * op::square(op::square(s.x[i]) + op::square(s.y[i]));
+    }
+
+    return H;
+
+}
+
+
+// The chain of N masses joined by springs
+struct chain {
+
+    std::vector<variable<double>> x, v;
+
+    chain(size_t n) {
+
+        for (size_t i{}; i < n; ++i) {
+            x.emplace_back(1.1 * i);
+            v.emplace_back(0.3 - 0.01 * i);
+        }
+
+    }
+
+};
+
+
+// Build the energy of the chain
+variable<double> energy(const chain& c) {
+
+    variable<double> E = 0.0;
+    for (size_t i{}; i < c.x.size(); ++i) {
+        E = E + 0.5 * 2.0 * c.v[i] * c.v[i];
+        if (i + 1 < c.x.size())
+            E = E + 0.5 * 3.0 * (c.x[i + 1] - c.x[i] - 1.0) * (c.x[i + 1] - c.x[i] - 1.0);
+    }
+
+    return E;
+
+}
+
+
+// Check the derivatives of the energy w.r.t. the position and the velocity of the first mass
+template <typename RESULT>
+bool matches(const RESULT& result, size_t n) {
+
+    const auto& [dE_dx, dE_dv] = result;
+    const double expected = n > 1 ? -3.0 * 0.1 : 0.0; // -k (x_1 - x_0 - L)
+    return std::abs(dE_dx - expected) <= 1e-12 && std::abs(dE_dv - 0.6) <= 1e-12; // m v_0
+
+}
+
+
+// Benchmark functions
+template <bool SIMPLIFY>
+static void BM_Hamiltonian(benchmark::State& state) {
+
+    phase_space s(state.range(0));
+    size_t nodes{};
+
+    for (auto _ : state) {
+
+        tape::scope recording;
+        std::optional<tape::simplification> simplify;
+        if constexpr (SIMPLIFY)
+            simplify.emplace();
+
+        auto H = ::hamiltonian(s);
+        auto result = derivatives(H, wrt(s.x[0], s.px[0]));
+        benchmark::DoNotOptimize(result);
+
+        nodes = tape::local().size();
+
+    }
+
+    state.counters["nodes"] = nodes;
+
+}
+
+
+template <bool SIMPLIFY>
+static void BM_HamiltonianGradient(benchmark::State& state) {
+
+    phase_space s(state.range(0));
+
+    std::optional<tape::simplification> simplify;
+    if constexpr (SIMPLIFY)
+        simplify.emplace();
+
+    auto H = ::hamiltonian(s);
+
+    for (auto _ : state) {
+        auto result = derivatives(H, wrt(s.x[0], s.px[0]));
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.counters["nodes"] = topological_order(H.expr.get()).size();
+
+}
+
+
+template <bool SIMPLIFY>
+static void BM_Chain(benchmark::State& state) {
+
+    chain c(state.range(0));
+    size_t nodes{};
+    bool valid{true};
+
+    for (auto _ : state) {
+
+        tape::scope recording;
+        std::optional<tape::simplification> simplify;
+        if constexpr (SIMPLIFY)
+            simplify.emplace();
+
+        auto E = energy(c);
+        auto result = derivatives(E, wrt(c.x[0], c.v[0]));
+        benchmark::DoNotOptimize(result);
+
+        valid = valid && matches(result, c.x.size());
+        nodes = tape::local().size();
+
+    }
+
+    state.counters["nodes"] = nodes;
+    if (!valid)
+        state.SkipWithError("Wrong derivatives of the energy of the chain");
+
+}
+
+
+template <bool SIMPLIFY>
+static void BM_ChainGradient(benchmark::State& state) {
+
+    chain c(state.range(0));
+
+    std::optional<tape::simplification> simplify;
+    if constexpr (SIMPLIFY)
+        simplify.emplace();
+
+    auto E = energy(c);
+    bool valid{true};
+
+    for (auto _ : state) {
+        auto result = derivatives(E, wrt(c.x[0], c.v[0]));
+        benchmark::DoNotOptimize(result);
+        valid = valid && matches(result, c.x.size());
+    }
+
+    state.counters["nodes"] = topological_order(E.expr.get()).size();
+    if (!valid)
+        state.SkipWithError("Wrong derivatives of the energy of the chain");
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_Hamiltonian<false>)->RangeMultiplier(4)->Range(1, 1024);
+BENCHMARK(BM_Hamiltonian<true>)->RangeMultiplier(4)->Range(1, 1024);
+BENCHMARK(BM_HamiltonianGradient<false>)->RangeMultiplier(4)->Range(1, 1024);
+BENCHMARK(BM_HamiltonianGradient<true>)->RangeMultiplier(4)->Range(1, 1024);
+BENCHMARK(BM_Chain<false>)->RangeMultiplier(4)->Range(1, 1024);
+BENCHMARK(BM_Chain<true>)->RangeMultiplier(4)->Range(1, 1024);
+BENCHMARK(BM_ChainGradient<false>)->RangeMultiplier(4)->Range(1, 1024);
+BENCHMARK(BM_ChainGradient<true>)->RangeMultiplier(4)->Range(1, 1024);
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,114 @@
+/**
+ * @file    benchmark/calculus/sparse.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the sparse jacobians and hessians.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing the jacobian of the forces of a ring of N particles w.r.t. their positions, 
+ *          by a gradient for every force and by sparse_jacobian, and the hessian of their energy by sparse_hessian.
+ * @date    2023-08-02
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// The positions of a ring of particles
+std::vector<variable<double>> positions(size_t n) {
+
+    std::vector<variable<double>> q;
+    q.reserve(n);
+    for (size_t i{}; i < n; ++i)
+        q.emplace_back(0.1 * static_cast<double>(i) + 0.05 * std::sin(static_cast<double>(i)));
+
+    return q;
+
+}
+
+// The forces between nearest neighbours
+std::vector<variable<double>> forces(const std::vector<variable<double>>& q) {
+
+    const size_t n = q.size();
+    std::vector<variable<double>> f;
+    f.reserve(n);
+    for (size_t i{}; i < n; ++i)
+        f.emplace_back(op::sin(q[(i + n - 1) % n] - q[i]) + op::sin(q[(i + 1) % n] - q[i]));
+
+    return f;
+
+}
+
+// The energy of the ring in a cubic potential
+variable<double> energy(const std::vector<variable<double>>& q) {
+
+    const size_t n = q.size();
+    std::vector<expr_ptr<double>> terms;
+    terms.reserve(n);
+    for (size_t i{}; i < n; ++i)
+        terms.push_back(1.0 - op::cos(q[(i + 1) % n] - q[i]) + q[i] * q[i] * q[i] * 0.5);
+
+    return op::sum(std::move(terms));
+
+}
+
+
+// Benchmark functions
+static void BM_Dense(benchmark::State& state) {
+
+    const auto q = positions(state.range(0));
+    const auto f = forces(q);
+    std::vector<double> row(q.size());
+
+    for (auto _ : state) 
+        for (const auto& fi : f) {
+            gradient(fi, std::span(q), std::span(row));
+            benchmark::DoNotOptimize(row.data());
+        }
+
+}
+
+static void BM_SparseJacobian(benchmark::State& state) {
+
+    const auto q = positions(state.range(0));
+    const auto f = forces(q);
+
+    std::vector<size_t> colors;
+    state.counters["colors"] = geometry::color_columns(jacobian_pattern(std::span(f), std::span(q)), colors);
+
+    for (auto _ : state) {
+
+        auto J = sparse_jacobian(std::span(f), std::span(q));
+        benchmark::DoNotOptimize(J);
+
+    }
+
+}
+
+static void BM_SparseHessian(benchmark::State& state) {
+
+    const auto q = positions(state.range(0));
+    const auto E = energy(q);
+
+    for (auto _ : state) {
+
+        auto H = sparse_hessian(E, std::span(q));
+        benchmark::DoNotOptimize(H);
+
+    }
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_Dense)->RangeMultiplier(4)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SparseJacobian)->RangeMultiplier(4)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SparseHessian)->RangeMultiplier(4)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+
+// Run the benchmark
+BENCHMARK_MAIN();
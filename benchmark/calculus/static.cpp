@@ -0,0 +1,182 @@
+/**
+ * @file    benchmark/calculus/static.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the static expression templates against the variables.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing the force of the elastic and of the gravitational potentials, 
+ *          evaluated by recording a graph of variables or by inlining a static expression,
+ *          and the gradients of the same pure formulas of doubles, without the units of measurement.
+ * @date    2023-07-24
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::physics;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// A formula of two variables, built by the same operations on variables and on static variables
+template <typename V>
+auto formula(const V& x, const V& y) {
+
+    return op::add(op::mult(x, op::sin(y)), op::mult(op::exp(x), op::inv(op::add(op::mult(y, y), 1.0))));
+
+}
+
+// A polynomial of degree 4, built by the Horner scheme on variables and on static variables
+template <typename V>
+auto polynomial(const V& x) {
+
+    return op::add(op::mult(op::add(op::mult(op::add(op::mult(op::add(op::mult(x, 5.0), 4.0), x), 3.0), x), 2.0), x), 1.0);
+
+}
+
+
+// Benchmark functions
+static void BM_FormulaGradientVariable(benchmark::State& state) {
+
+    variable<double> x = 0.5, y = 1.5;
+
+    for (auto _ : state) {
+        variable<double> z = formula(x, y);
+        auto grad = derivatives(z, wrt(x, y));
+        benchmark::DoNotOptimize(grad);
+    }
+
+}
+
+static void BM_FormulaGradientStatic(benchmark::State& state) {
+
+    static_variable<double> x = 0.5, y = 1.5;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(x.val);
+        benchmark::DoNotOptimize(y.val);
+        auto z = formula(x, y);
+        auto grad = derivatives(z, wrt(x, y));
+        benchmark::DoNotOptimize(grad);
+    }
+
+}
+
+static void BM_PolynomialDerivativeVariable(benchmark::State& state) {
+
+    variable<double> x = 0.5;
+
+    for (auto _ : state) {
+        variable<double> p = polynomial(x);
+        auto dp = derivatives(p, wrt(x));
+        benchmark::DoNotOptimize(dp);
+    }
+
+}
+
+static void BM_PolynomialDerivativeStatic(benchmark::State& state) {
+
+    static_variable<double> x = 0.5;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(x.val);
+        auto p = polynomial(x);
+        auto dp = derivatives(p, wrt(x));
+        benchmark::DoNotOptimize(dp);
+    }
+
+}
+
+static void BM_ElasticForceVariable(benchmark::State& state) {
+
+    potentials::elastic V(3.0 * (units::N / units::m), 1.0 * units::m);
+    variable<measurement<base::length>> x = 2.5 * units::m;
+
+    for (auto _ : state) {
+        auto F = V.force(x);
+        benchmark::DoNotOptimize(F);
+    }
+
+}
+
+static void BM_ElasticForceStatic(benchmark::State& state) {
+
+    potentials::elastic V(3.0 * (units::N / units::m), 1.0 * units::m);
+    static_variable<measurement<base::length>> x = 2.5 * units::m;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(x.val);
+        auto F = force(V, x);
+        benchmark::DoNotOptimize(F);
+    }
+
+}
+
+static void BM_GravitationalForceVariable(benchmark::State& state) {
+
+    potentials::gravitational V(5.0 * units::kg, 7.0 * units::kg);
+    variable<measurement<base::length>> x = 2.5 * units::m;
+
+    for (auto _ : state) {
+        auto F = V.force(x);
+        benchmark::DoNotOptimize(F);
+    }
+
+}
+
+static void BM_GravitationalForceStatic(benchmark::State& state) {
+
+    potentials::gravitational V(5.0 * units::kg, 7.0 * units::kg);
+    static_variable<measurement<base::length>> x = 2.5 * units::m;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(x.val);
+        auto F = force(V, x);
+        benchmark::DoNotOptimize(F);
+    }
+
+}
+
+static void BM_KineticEnergyGradientVariable(benchmark::State& state) {
+
+    const auto m = 3.0 * units::kg;
+    variable<measurement<base::velocity>> v = 2.0 * (units::m / units::s);
+
+    for (auto _ : state) {
+        auto p = derivatives(kinetic_energy(m, v), wrt(v));
+        benchmark::DoNotOptimize(p);
+    }
+
+}
+
+static void BM_KineticEnergyGradientStatic(benchmark::State& state) {
+
+    const auto m = 3.0 * units::kg;
+    static_variable<measurement<base::velocity>> v = 2.0 * (units::m / units::s);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v.val);
+        auto p = derivatives(kinetic_energy(m, v), wrt(v));
+        benchmark::DoNotOptimize(p);
+    }
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_FormulaGradientVariable);
+BENCHMARK(BM_FormulaGradientStatic);
+BENCHMARK(BM_PolynomialDerivativeVariable);
+BENCHMARK(BM_PolynomialDerivativeStatic);
+BENCHMARK(BM_ElasticForceVariable);
+BENCHMARK(BM_ElasticForceStatic);
+BENCHMARK(BM_GravitationalForceVariable);
+BENCHMARK(BM_GravitationalForceStatic);
+BENCHMARK(BM_KineticEnergyGradientVariable);
+BENCHMARK(BM_KineticEnergyGradientStatic);
+
+// Run the benchmark
+BENCHMARK_MAIN();
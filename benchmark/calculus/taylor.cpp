@@ -0,0 +1,78 @@
+/**
+ * @file    benchmark/calculus/taylor.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the taylor mode.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing the first N derivatives of y = exp(sin(x)) * log(1 + x^2) / sqrt(x), 
+ *          computed by a single taylor propagation or by N nested derivativesx sweeps.
+ * @date    2023-07-30
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// Build the expression of the benchmark
+variable<double> model(const variable<double>& x) {
+
+    return op::exp(op::sin(x)) * op::log(1.0 + op::square(x)) / op::sqrt(x);
+
+}
+
+
+// Benchmark functions
+template <size_t N>
+static void BM_Taylor(benchmark::State& state) {
+
+    variable<double> x = 0.8;
+    const auto y = model(x);
+
+    for (auto _ : state) {
+        auto series = taylor<N>(y, wrt(x));
+        benchmark::DoNotOptimize(series);
+    }
+
+}
+
+template <size_t N>
+static void BM_Nested(benchmark::State& state) {
+
+    variable<double> x = 0.8;
+    const auto y = model(x);
+
+    for (auto _ : state) {
+
+        taylor_series<N, double> series;
+        series.derivatives[0] = static_cast<double>(y);
+
+        variable<double> dy = y;
+        for (size_t k{1}; k < N; ++k) {
+            dy = derivativesx(dy, wrt(x));
+            series.derivatives[k] = static_cast<double>(dy);
+        }
+        series.derivatives[N] = derivatives(dy, wrt(x));
+
+        benchmark::DoNotOptimize(series);
+
+    }
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_Taylor<2>);
+BENCHMARK(BM_Nested<2>);
+BENCHMARK(BM_Taylor<4>);
+BENCHMARK(BM_Nested<4>);
+BENCHMARK(BM_Taylor<6>);
+BENCHMARK(BM_Nested<6>);
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,168 @@
+/**
+ * @file    benchmark/calculus/tensor.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarking of the vector nodes against the componentwise vectors of scalar nodes.
+ *          The benchmarking is done with the Google Benchmark library.
+ *          Testing the energy E = sum_i |p_i+1 - p_i| + p_i . (A p_i+1) of a chain of N points in three dimensions, 
+ *          recorded with a scalar node for every component, or with a single node for every vector operation, 
+ *          and its gradient w.r.t. all the points by a single sweep. The number of nodes of the graph is reported.
+ * @date    2023-08-01
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include <benchmark/benchmark.h>
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+using vec3 = geometry::column_vector<double, 3>;
+
+using mat3 = geometry::matrix<vec3, 3>;
+
+const mat3 A{vec3{0.9, 0.1, -0.2}, vec3{0.1, 1.1, 0.3}, vec3{-0.2, 0.3, 0.8}};
+
+
+// The positions of the points along a helix
+vec3 position(size_t i) {
+
+    const double t = 0.1 * i;
+    return vec3{std::cos(t), std::sin(t), 0.05 * t};
+
+}
+
+
+// The energy of the chain, with a scalar variable for every component
+variable<double> componentwise(const std::vector<variable<double>>& x) {
+
+    const size_t n = x.size() / 3;
+    std::vector<expr_ptr<double>> terms;
+
+    for (size_t i{}; i + 1 < n; ++i) {
+
+        const auto* p = &x[3 * i];
+        const auto* q = &x[3 * i + 3];
+
+        std::array<expr_ptr<double>, 3> d, Aq;
+        for (size_t k{}; k < 3; ++k) {
+            d[k] = q[k].expr - p[k].expr;
+            Aq[k] = A.data[0].data[k] * q[0].expr + A.data[1].data[k] * q[1].expr + A.data[2].data[k] * q[2].expr;
+        }
+
+        terms.push_back(op::sqrt(op::square(d[0]) + op::square(d[1]) + op::square(d[2])));
+        terms.push_back(p[0].expr * Aq[0] + p[1].expr * Aq[1] + p[2].expr * Aq[2]);
+
+    }
+
+    return op::sum(std::move(terms));
+
+}
+
+// The energy of the chain, with a vector variable for every point
+variable<double> tensor(const std::vector<variable<vec3>>& p) {
+
+    std::vector<expr_ptr<double>> terms;
+
+    for (size_t i{}; i + 1 < p.size(); ++i) {
+
+        terms.push_back(op::norm(p[i + 1] - p[i]));
+        terms.push_back(op::dot(p[i], A * p[i + 1]));
+
+    }
+
+    return op::sum(std::move(terms));
+
+}
+
+
+// Benchmark functions
+static void BM_ComponentwiseRecord(benchmark::State& state) {
+
+    std::vector<variable<double>> x;
+    for (int64_t i{}; i < state.range(0); ++i)
+        for (size_t k{}; k < 3; ++k)
+            x.emplace_back(position(i).data[k]);
+
+    for (auto _ : state) {
+        auto y = componentwise(x);
+        benchmark::DoNotOptimize(y);
+    }
+
+    state.counters["nodes"] = topological_order(componentwise(x).expr.get()).size();
+
+}
+
+static void BM_TensorRecord(benchmark::State& state) {
+
+    std::vector<variable<vec3>> p;
+    for (int64_t i{}; i < state.range(0); ++i)
+        p.emplace_back(position(i));
+
+    for (auto _ : state) {
+        auto y = tensor(p);
+        benchmark::DoNotOptimize(y);
+    }
+
+    state.counters["nodes"] = topological_order(tensor(p).expr.get()).size();
+
+}
+
+static void BM_ComponentwiseGradient(benchmark::State& state) {
+
+    std::vector<variable<double>> x;
+    for (int64_t i{}; i < state.range(0); ++i)
+        for (size_t k{}; k < 3; ++k)
+            x.emplace_back(position(i).data[k]);
+
+    const auto y = componentwise(x);
+    std::vector<double> grad(x.size());
+
+    for (auto _ : state) {
+        gradient(y, std::span(x), std::span(grad));
+        benchmark::DoNotOptimize(grad.data());
+    }
+
+}
+
+static void BM_TensorGradient(benchmark::State& state) {
+
+    std::vector<variable<vec3>> p;
+    for (int64_t i{}; i < state.range(0); ++i)
+        p.emplace_back(position(i));
+
+    const auto y = tensor(p);
+    std::vector<vec3> grad(p.size());
+
+    for (auto _ : state) {
+        gradient(y, std::span(p), std::span(grad));
+        benchmark::DoNotOptimize(grad.data());
+    }
+
+    // Check the result against the componentwise graph
+    std::vector<variable<double>> x;
+    for (int64_t i{}; i < state.range(0); ++i)
+        for (size_t k{}; k < 3; ++k)
+            x.emplace_back(position(i).data[k]);
+
+    std::vector<double> expected(x.size());
+    gradient(componentwise(x), std::span(x), std::span(expected));
+
+    for (size_t i{}; i < x.size(); ++i)
+        if (std::abs(grad[i / 3].data[i % 3] - expected[i]) > 1e-12)
+            state.SkipWithError("Wrong gradient w.r.t. the vector variables");
+
+}
+
+
+// Register the benchmarks
+BENCHMARK(BM_ComponentwiseRecord)->RangeMultiplier(4)->Range(64, 4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TensorRecord)->RangeMultiplier(4)->Range(64, 4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ComponentwiseGradient)->RangeMultiplier(4)->Range(64, 4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TensorGradient)->RangeMultiplier(4)->Range(64, 4096)->Unit(benchmark::kMicrosecond);
+
+// Run the benchmark
+BENCHMARK_MAIN();
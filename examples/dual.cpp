@@ -0,0 +1,46 @@
+/**
+ * @file    examples/dual.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   Example of forward mode automatic differentiation with dual numbers that preserve dimensional analysis
+ * @date    2023-07-22
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+#include "scipp"
+
+
+using namespace scipp;
+using namespace scipp::physics; 
+using namespace scipp::math;
+using tools::print; 
+
+
+int main() {
+
+    measurement<base::length> x0 = 2.0 * units::m;
+    measurement<base::time> t0 = 4.0 * units::s;
+
+    auto [x, t] = make_duals(x0, t0); // both the derivatives come out of a single pass
+
+    auto v = x / t; 
+    auto E = op::square(v) * x; 
+
+    print("E = ", E.real);
+    print("dE_dx = ", E.derivative<measurement<base::length>>(0));
+    print("dE_dt = ", E.derivative<measurement<base::time>>(1));
+
+
+    geometry::vector<measurement<base::length>, 3> p0{{1.0 * units::m, 2.0 * units::m, 2.0 * units::m}};
+
+    auto p = make_duals(p0); 
+    auto r = op::norm(p);
+
+    print("r = ", r.real);
+    print("dr_dx = ", r.derivative<measurement<base::length>>(0));
+    print("dr_dy = ", r.derivative<measurement<base::length>>(1));
+    print("dr_dz = ", r.derivative<measurement<base::length>>(2));
+
+    return 0; 
+
+}
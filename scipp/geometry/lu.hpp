@@ -0,0 +1,222 @@
+/**
+ * @file    geometry/lu.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the LU factorization of a square matrix with partial pivoting.
+ * @date    2023-08-02
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::geometry {
+
+
+    /// @brief The factorization P A = L U of a square matrix A, with the rows permuted by P for partial pivoting.
+    /// @note  L is unit lower triangular and U is upper triangular, both stored in the same matrix. 
+    ///        The factorization costs O(n^3) once, then every solve costs O(n^2), with A or with its transpose.
+    ///        A singular matrix is factorized with a zero pivot: its determinant is zero, while solving with it throws.
+    template <typename MATRIX_TYPE>
+        requires (is_matrix_v<MATRIX_TYPE>)
+    struct lu_factorization {
+
+
+        // ===========================================================
+        // static members
+        // ===========================================================
+
+            inline static constexpr size_t dim = MATRIX_TYPE::rows;
+
+
+        // ===========================================================
+        // aliases
+        // ===========================================================
+
+            using matrix_t = MATRIX_TYPE;
+
+            using element_t = typename MATRIX_TYPE::element_t;
+
+            using vector_t = column_vector<element_t, dim>;
+
+
+        // ===========================================================
+        // members
+        // ===========================================================
+
+            matrix_t factors; ///< The factors L and U, below and above the diagonal.
+
+            std::array<size_t, dim> pivots; ///< The row of A moved to every row of P A.
+
+            element_t sign{1}; ///< The sign of the permutation P.
+
+            bool singular{false}; ///< If a pivot is zero.
+
+
+        // ===========================================================
+        // constructors
+        // ===========================================================
+
+            /// @brief Factorize a square matrix 
+            constexpr explicit lu_factorization(const matrix_t& A) : factors(A) {
+
+                static_assert(MATRIX_TYPE::rows == MATRIX_TYPE::columns, "Cannot factorize a matrix which is not square.");
+
+                for (size_t i{}; i < dim; ++i)
+                    pivots[i] = i;
+
+                for (size_t k{}; k < dim; ++k) {
+
+                    size_t p = k;
+                    for (size_t i = k + 1; i < dim; ++i)
+                        if (std::abs(at(i, k)) > std::abs(at(p, k)))
+                            p = i;
+
+                    if (at(p, k) == element_t{}) {
+                        singular = true;
+                        continue;
+                    }
+
+                    if (p != k) {
+                        for (size_t j{}; j < dim; ++j)
+                            std::swap(at(p, j), at(k, j));
+                        std::swap(pivots[p], pivots[k]);
+                        sign = -sign;
+                    }
+
+                    for (size_t i = k + 1; i < dim; ++i)
+                        at(i, k) /= at(k, k);
+
+                    for (size_t j = k + 1; j < dim; ++j)
+                        for (size_t i = k + 1; i < dim; ++i)
+                            at(i, j) -= at(i, k) * at(k, j);
+
+                }
+
+            }
+
+
+        // ===========================================================
+        // methods
+        // ===========================================================
+
+            /// @brief Return the determinant of the factorized matrix
+            constexpr element_t determinant() const noexcept {
+
+                element_t result = sign;
+                for (size_t i{}; i < dim; ++i)
+                    result *= at(i, i);
+
+                return result;
+
+            }
+
+
+            /// @brief Return the solution x of A x = b
+            /// @note  Throws a std::runtime_error if the matrix is singular.
+            constexpr vector_t solve(const vector_t& b) const {
+
+                this->check();
+
+                vector_t x;
+                for (size_t i{}; i < dim; ++i)
+                    x.data[i] = b.data[pivots[i]];
+
+                for (size_t j{}; j < dim; ++j)
+                    for (size_t i = j + 1; i < dim; ++i)
+                        x.data[i] -= at(i, j) * x.data[j];
+
+                for (size_t j = dim; j-- > 0; ) {
+                    x.data[j] /= at(j, j);
+                    for (size_t i{}; i < j; ++i)
+                        x.data[i] -= at(i, j) * x.data[j];
+                }
+
+                return x;
+
+            }
+
+            /// @brief Return the solution x of A^T x = b
+            /// @note  Throws a std::runtime_error if the matrix is singular.
+            constexpr vector_t solve_transposed(const vector_t& b) const {
+
+                this->check();
+
+                vector_t y = b;
+                for (size_t i{}; i < dim; ++i) {
+                    for (size_t k{}; k < i; ++k)
+                        y.data[i] -= at(k, i) * y.data[k];
+                    y.data[i] /= at(i, i);
+                }
+
+                for (size_t i = dim; i-- > 0; )
+                    for (size_t k = i + 1; k < dim; ++k)
+                        y.data[i] -= at(k, i) * y.data[k];
+
+                vector_t x;
+                for (size_t i{}; i < dim; ++i)
+                    x.data[pivots[i]] = y.data[i];
+
+                return x;
+
+            }
+
+
+            /// @brief Return the solution X of A X = B, column by column
+            template <size_t COLUMNS>
+            constexpr auto solve(const matrix<vector_t, COLUMNS>& B) const {
+
+                matrix<vector_t, COLUMNS> X;
+                for (size_t j{}; j < COLUMNS; ++j)
+                    X.data[j] = this->solve(B.data[j]);
+
+                return X;
+
+            }
+
+            /// @brief Return the solution X of A^T X = B, column by column
+            template <size_t COLUMNS>
+            constexpr auto solve_transposed(const matrix<vector_t, COLUMNS>& B) const {
+
+                matrix<vector_t, COLUMNS> X;
+                for (size_t j{}; j < COLUMNS; ++j)
+                    X.data[j] = this->solve_transposed(B.data[j]);
+
+                return X;
+
+            }
+
+
+            /// @brief Return the inverse of the factorized matrix
+            /// @note  Throws a std::runtime_error if the matrix is singular.
+            constexpr matrix_t inverse() const {
+
+                matrix_t result;
+                for (size_t j{}; j < dim; ++j) {
+                    vector_t e{};
+                    e.data[j] = element_t{1};
+                    result.data[j] = this->solve(e);
+                }
+
+                return result;
+
+            }
+
+
+        private: 
+
+            constexpr void check() const {
+
+                if (singular)
+                    throw std::runtime_error("Cannot solve a system with a singular matrix");
+
+            }
+
+            constexpr element_t& at(size_t i, size_t j) noexcept { return factors.data[j].data[i]; }
+
+            constexpr const element_t& at(size_t i, size_t j) const noexcept { return factors.data[j].data[i]; }
+
+
+    }; // struct lu_factorization
+
+
+} // namespace scipp::geometry
@@ -157,6 +157,27 @@ namespace scipp::geometry {
             }
 
 
+            /// @brief Add another matrix to this matrix, column by column
+            constexpr matrix& operator+=(const matrix& other) noexcept {
+
+                for (size_t j{}; j < columns; ++j)
+                    this->data[j] += other.data[j];
+
+                return *this;
+
+            }
+
+            /// @brief Subtract another matrix from this matrix, column by column
+            constexpr matrix& operator-=(const matrix& other) noexcept {
+
+                for (size_t j{}; j < columns; ++j)
+                    this->data[j] -= other.data[j];
+
+                return *this;
+
+            }
+
+
         // ===========================================================
         // callable methods
         // ===========================================================
@@ -398,7 +419,7 @@ namespace scipp::geometry {
 
             /// @brief Get the determinant of the matrix
             constexpr auto determinant() const noexcept 
-                -> math::functions::power_t<columns, element_t> 
+                -> math::op::power_t<columns, element_t> 
                     requires (columns == rows) {
 
                 if constexpr (columns == 1)
@@ -423,7 +444,7 @@ namespace scipp::geometry {
 
             /// @brief Get the cofactor at row and column
             constexpr auto cofactor(const size_t& row_i, const size_t& col_j) const noexcept 
-                -> math::functions::power_t<columns - 1, element_t>
+                -> math::op::power_t<columns - 1, element_t>
                     requires (columns == rows) {
                 
                 auto submatrix = this->submatrix(row_i, col_j);
@@ -434,10 +455,10 @@ namespace scipp::geometry {
 
             /// @brief Get the adjoint matrix
             constexpr auto adjoint() const noexcept 
-                -> matrix<vector<math::functions::power_t<columns - 1, element_t>, columns>, rows> 
+                -> matrix<vector<math::op::power_t<columns - 1, element_t>, columns>, rows> 
                     requires (columns == rows) {
 
-                std::array<vector<math::functions::power_t<columns - 1, element_t>, columns>, rows> result;
+                std::array<vector<math::op::power_t<columns - 1, element_t>, columns>, rows> result;
                 for (size_t i{}; i < columns; ++i) 
                     for (size_t j{}; j < rows; ++j) 
                         result[i][j] = this->cofactor(j, i);
@@ -449,7 +470,7 @@ namespace scipp::geometry {
 
             /// @brief Get the inverse of the matrix
             constexpr auto inverse() const 
-                -> matrix<vector<math::functions::invert_t<element_t>, columns>, rows>
+                -> matrix<vector<math::op::invert_t<element_t>, columns>, rows>
                     requires (columns == rows) {
 
                 if (this->determinant().value == 0.0) 
@@ -0,0 +1,218 @@
+/**
+ * @file    geometry/sparse_matrix.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the sparse matrices in compressed sparse row format, 
+ *          and of the coloring of their columns.
+ * @date    2023-08-02
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::geometry {
+
+
+    /// @brief The positions of the nonzero elements of a matrix, in compressed sparse row format.
+    /// @note  The columns of the nonzeros of the row i are indices[offsets[i]] ... indices[offsets[i + 1] - 1], sorted.
+    struct sparsity_pattern {
+
+
+        // ===========================================================
+        // members
+        // ===========================================================
+
+            size_t rows{}, columns{}; ///< The shape of the matrix.
+
+            std::vector<size_t> offsets{0}; ///< The position of the first nonzero of every row, and the number of nonzeros.
+
+            std::vector<size_t> indices; ///< The column of every nonzero.
+
+
+        // ===========================================================
+        // methods
+        // ===========================================================
+
+            /// @brief Return the number of nonzero elements
+            size_t nonzeros() const noexcept {
+
+                return indices.size();
+
+            }
+
+
+            /// @brief Append a row with the nonzeros at some sorted columns
+            void push_row(std::span<const size_t> row) {
+
+                indices.insert(indices.end(), row.begin(), row.end());
+                offsets.push_back(indices.size());
+                ++rows;
+
+            }
+
+
+            /// @brief Return the position of the element at row and column among the nonzeros, or nonzeros() if it is zero
+            /// @note  Throws a std::out_of_range if the row or the column is out of the matrix.
+            size_t find(size_t row_i, size_t col_j) const {
+
+                if (row_i >= rows) 
+                    throw std::out_of_range("Cannot access row " + std::to_string(row_i) + " from a matrix with " + std::to_string(rows) + " rows."); 
+                else if (col_j >= columns) 
+                    throw std::out_of_range("Cannot access column " + std::to_string(col_j) + " from a matrix with " + std::to_string(columns) + " columns."); 
+
+                const auto first = std::next(indices.begin(), offsets[row_i]), last = std::next(indices.begin(), offsets[row_i + 1]);
+                const auto position = std::lower_bound(first, last, col_j);
+
+                return (position != last && *position == col_j) ? static_cast<size_t>(std::distance(indices.begin(), position)) : nonzeros();
+
+            }
+
+
+            /// @brief Return the pattern of the transposed matrix
+            sparsity_pattern transpose() const {
+
+                sparsity_pattern result;
+                result.rows = columns;
+                result.columns = rows;
+                result.offsets.assign(columns + 1, 0);
+                result.indices.resize(nonzeros());
+
+                for (auto j : indices)
+                    ++result.offsets[j + 1];
+
+                for (size_t j{}; j < columns; ++j)
+                    result.offsets[j + 1] += result.offsets[j];
+
+                std::vector<size_t> next(result.offsets.begin(), std::prev(result.offsets.end()));
+                for (size_t i{}; i < rows; ++i)
+                    for (size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+                        result.indices[next[indices[k]]++] = i;
+
+                return result;
+
+            }
+
+
+    }; // struct sparsity_pattern
+
+
+    /// @brief A matrix storing only the elements at the positions of a sparsity pattern, in compressed sparse row format.
+    template <typename T>
+    struct sparse_matrix : sparsity_pattern {
+
+
+        // ===========================================================
+        // aliases
+        // ===========================================================
+
+            using value_t = T;
+
+
+        // ===========================================================
+        // members
+        // ===========================================================
+
+            std::vector<T> values; ///< The value of every nonzero, in the order of the pattern.
+
+
+        // ===========================================================
+        // constructors
+        // ===========================================================
+
+            /// @brief Default constructor 
+            sparse_matrix() = default;
+
+            /// @brief Construct a sparse matrix with all the nonzeros of a pattern set to zero
+            explicit sparse_matrix(const sparsity_pattern& pattern) : 
+                sparsity_pattern(pattern), values(pattern.nonzeros(), T{}) {}
+
+
+        // ===========================================================
+        // methods
+        // ===========================================================
+
+            /// @brief Return the element at row and column
+            /// @note  Throws a std::out_of_range if the row or the column is out of the matrix.
+            T operator()(size_t row_i, size_t col_j) const {
+
+                const size_t k = this->find(row_i, col_j);
+
+                return (k < nonzeros()) ? values[k] : T{};
+
+            }
+
+
+            /// @brief Return the product of this matrix and a vector of the size of its columns
+            /// @note  Throws a std::invalid_argument if the sizes are different.
+            template <typename U>
+            auto multiply(std::span<const U> x) const {
+
+                if (x.size() != columns)
+                    throw std::invalid_argument("Cannot multiply a matrix with " + std::to_string(columns) + 
+                                                " columns and a vector of size " + std::to_string(x.size()) + ".");
+
+                using result_t = decltype(std::declval<T>() * std::declval<U>());
+
+                std::vector<result_t> result(rows);
+                for (size_t i{}; i < rows; ++i)
+                    for (size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+                        result[i] += values[k] * x[indices[k]];
+
+                return result;
+
+            }
+
+
+    }; // struct sparse_matrix
+
+
+    /// @brief Return a coloring of the columns of a sparsity pattern, in which the columns with a nonzero in the same row
+    ///        have different colors, as the number of colors.
+    /// @note  It is the distance-1 coloring of the graph of the columns intersecting in some row, 
+    ///        or the distance-2 coloring of the columns in the bipartite graph of the rows and the columns: 
+    ///        the columns of a color can be seeded at once, since every row reads at most one of them.
+    ///        The columns are colored greedily, the ones with most nonzeros first, with the smallest color available.
+    inline size_t color_columns(const sparsity_pattern& pattern, std::vector<size_t>& colors) {
+
+        const auto transposed = pattern.transpose();
+
+        std::vector<size_t> order(pattern.columns);
+        std::iota(order.begin(), order.end(), size_t{});
+        std::ranges::stable_sort(order, std::greater<>{}, [&](size_t j) { return transposed.offsets[j + 1] - transposed.offsets[j]; });
+
+        constexpr size_t uncolored = std::numeric_limits<size_t>::max();
+        colors.assign(pattern.columns, uncolored);
+
+        std::vector<size_t> forbidden; ///< The last column for which every color has been forbidden.
+        size_t count{};
+
+        for (auto j : order) {
+
+            for (size_t k = transposed.offsets[j]; k < transposed.offsets[j + 1]; ++k) {
+
+                const size_t i = transposed.indices[k];
+                for (size_t l = pattern.offsets[i]; l < pattern.offsets[i + 1]; ++l)
+                    if (const size_t c = colors[pattern.indices[l]]; c != uncolored)
+                        forbidden[c] = j;
+
+            }
+
+            size_t c{};
+            while (c < count && forbidden[c] == j)
+                ++c;
+
+            if (c == count) {
+                forbidden.push_back(uncolored);
+                ++count;
+            }
+
+            colors[j] = c;
+
+        }
+
+        return count;
+
+    }
+
+
+} // namespace scipp::geometry
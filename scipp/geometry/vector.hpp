@@ -208,6 +208,27 @@ namespace scipp::geometry {
 
             }
 
+
+            /// @brief Add another vector to this vector, component by component
+            constexpr vector& operator+=(const vector& other) noexcept {
+
+                for (size_t i{}; i < dim; ++i)
+                    this->data[i] = math::op::add(this->data[i], other.data[i]);
+
+                return *this; 
+
+            }
+
+            /// @brief Subtract another vector from this vector, component by component
+            constexpr vector& operator-=(const vector& other) noexcept {
+
+                for (size_t i{}; i < dim; ++i)
+                    this->data[i] = math::op::sub(this->data[i], other.data[i]);
+
+                return *this; 
+
+            }
+
         
         // ===========================================================
         // methods
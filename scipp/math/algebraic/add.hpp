@@ -23,8 +23,16 @@ namespace scipp::math {
             using result_t = calculus::expr_ptr<add_t<T1, T2>>;
             
             static constexpr result_t f(const calculus::expr_ptr<T1>& x, const calculus::expr_ptr<T2>& y) noexcept {
+
+                if constexpr (std::is_same_v<add_t<T1, T2>, T1> && is_number_v<T2>)
+                    if (calculus::is_constant(y, T2{0}))
+                        return x;
+
+                if constexpr (std::is_same_v<add_t<T1, T2>, T2> && is_number_v<T1>)
+                    if (calculus::is_constant(x, T1{0}))
+                        return y;
                 
-                return std::make_shared<calculus::add_expr<add_t<T1, T2>, T1, T2>>(x->val + y->val, x, y);
+                return calculus::make_operation<calculus::add_expr<add_t<T1, T2>, T1, T2>>(x->val + y->val, x, y);
 
             }
                     
@@ -201,12 +209,27 @@ namespace scipp::math {
             static constexpr result_t f(const T1& x, const T2& y) noexcept { 
 
                 result_t result;
-                std::for_each(std::execution::par, result.data.begin(), result.data.end(), 
-                    [&](auto& elem) {
-                        auto index = &elem - result.data.data();
-                        elem = x.data[index] + y.data[index];
-                    }
-                );
+                for (size_t i{}; i < T1::dim; ++i)
+                    result.data[i] = x.data[i] + y.data[i];
+                
+                return result;
+            
+            }
+
+        };
+
+
+        template <typename T1, typename T2>
+            requires (geometry::are_matrix_v<T1, T2> && T1::rows == T2::rows && T1::columns == T2::columns)
+        struct add_impl<T1, T2> {
+
+            using result_t = geometry::matrix<add_t<typename T1::value_t, typename T2::value_t>, T1::columns>;
+
+            static constexpr result_t f(const T1& x, const T2& y) noexcept { 
+
+                result_t result;
+                for (size_t j{}; j < T1::columns; ++j)
+                    result.data[j] = op::add(x.data[j], y.data[j]);
                 
                 return result;
             
@@ -215,6 +238,75 @@ namespace scipp::math {
         };
         
 
+
+        /// @brief Add specialization for dual numbers
+        template <typename T1, typename T2>
+            requires (are_duals_v<T1, T2> && T1::dim == T2::dim)
+        struct add_impl<T1, T2> {
+
+            using result_t = dual<add_t<typename T1::value_t, typename T2::value_t>, T1::dim>;
+
+            static constexpr result_t f(const T1& x, const T2& y) noexcept {
+
+                result_t result(op::add(x.real, y.real));
+                for (size_t i{}; i < T1::dim; ++i)
+                    result.imag[i] = op::add(x.imag[i], y.imag[i]);
+
+                return result;
+
+            }
+
+        };
+
+
+        /// @brief Add specialization for dual numbers and numbers / physics::measurements
+        template <typename T1, typename T2>
+            requires (is_dual_v<T1> && (is_number_v<T2> || physics::is_measurement_v<T2>))
+        struct add_impl<T1, T2> {
+
+            using result_t = dual<add_t<typename T1::value_t, T2>, T1::dim>;
+
+            static constexpr result_t f(const T1& x, const T2& y) noexcept {
+
+                return {op::add(x.real, y), x.imag};
+
+            }
+
+        };
+
+        template <typename T1, typename T2>
+            requires ((is_number_v<T1> || physics::is_measurement_v<T1>) && is_dual_v<T2>)
+        struct add_impl<T1, T2> {
+
+            using result_t = dual<add_t<T1, typename T2::value_t>, T2::dim>;
+
+            static constexpr result_t f(const T1& x, const T2& y) noexcept {
+
+                return {op::add(x, y.real), y.imag};
+
+            }
+
+        };
+
+
+        /// @brief Add specialization for static expressions
+        template <typename T1, typename T2>
+            requires (calculus::is_static_expr_v<T1> || calculus::is_static_expr_v<T2>)
+        struct add_impl<T1, T2> {
+
+            using result_t = calculus::static_add_expr<calculus::static_t<T1>, calculus::static_t<T2>>;
+
+            /// @note The operands are deduced, since op::sub passes the negate node of the second one.
+            template <typename U1, typename U2>
+            static constexpr auto f(const U1& x, const U2& y) noexcept {
+
+                return calculus::static_add_expr<calculus::static_t<U1>, calculus::static_t<U2>>(calculus::to_static(x), calculus::to_static(y));
+
+            }
+
+        };
+
+
     } // namespace op
 
 
@@ -0,0 +1,158 @@
+/**
+ * @file    scipp/math/algebraic/cross.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the cross product of three dimensional vectors
+ * @date    2023-08-01
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace op {
+
+
+        /// @brief Cross specialization for expr_ptrs, recorded as a single node
+        template <typename T1, typename T2>
+        struct cross_impl<calculus::expr_ptr<T1>, calculus::expr_ptr<T2>> {
+
+            using result_t = calculus::expr_ptr<cross_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::expr_ptr<T1>& x, const calculus::expr_ptr<T2>& y) noexcept {
+
+                return calculus::make_operation<calculus::cross_expr<cross_t<T1, T2>, T1, T2>>(cross(x->val, y->val), x, y);
+
+            }
+                    
+        };
+
+
+        /// @brief Cross specialization for expr_ptr and value
+        template <typename T1, typename T2>
+            requires (geometry::is_vector_v<T2>)
+        struct cross_impl<calculus::expr_ptr<T1>, T2> {
+
+            using result_t = calculus::expr_ptr<cross_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::expr_ptr<T1>& x, const T2& y) noexcept {
+                
+                return cross(x, calculus::constant<T2>(y));
+
+            }
+                    
+        };
+
+        template <typename T1, typename T2>
+            requires (geometry::is_vector_v<T1>)
+        struct cross_impl<T1, calculus::expr_ptr<T2>> {
+
+            using result_t = calculus::expr_ptr<cross_t<T1, T2>>;
+            
+            static constexpr result_t f(const T1& x, const calculus::expr_ptr<T2>& y) noexcept {
+                
+                return cross(calculus::constant<T1>(x), y);
+
+            }
+                    
+        };
+
+
+        /// @brief Cross specialization for variables
+        template <typename T1, typename T2>
+        struct cross_impl<calculus::variable<T1>, calculus::variable<T2>> {
+
+            using result_t = calculus::expr_ptr<cross_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::variable<T1>& x, const calculus::variable<T2>& y) noexcept {
+                
+                return cross(x.expr, y.expr);   
+
+            }
+                    
+        };
+
+        template <typename T1, typename T2>
+        struct cross_impl<calculus::variable<T1>, calculus::expr_ptr<T2>> {
+
+            using result_t = calculus::expr_ptr<cross_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::variable<T1>& x, const calculus::expr_ptr<T2>& y) noexcept {
+                
+                return cross(x.expr, y);   
+
+            }
+                    
+        };
+
+        template <typename T1, typename T2>
+        struct cross_impl<calculus::expr_ptr<T1>, calculus::variable<T2>> {
+
+            using result_t = calculus::expr_ptr<cross_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::expr_ptr<T1>& x, const calculus::variable<T2>& y) noexcept {
+                
+                return cross(x, y.expr);   
+
+            }
+                    
+        };
+
+
+        /// @brief Cross specialization for variable and value
+        template <typename T1, typename T2>
+            requires (geometry::is_vector_v<T2>)
+        struct cross_impl<calculus::variable<T1>, T2> {
+
+            using result_t = calculus::expr_ptr<cross_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::variable<T1>& x, const T2& y) noexcept {
+                
+                return cross(x.expr, y);   
+
+            }
+                    
+        };
+
+        template <typename T1, typename T2>
+            requires (geometry::is_vector_v<T1>)
+        struct cross_impl<T1, calculus::variable<T2>> {
+
+            using result_t = calculus::expr_ptr<cross_t<T1, T2>>;
+            
+            static constexpr result_t f(const T1& x, const calculus::variable<T2>& y) noexcept {
+                
+                return cross(x, y.expr);   
+
+            }
+                    
+        };
+
+
+        /// @brief Cross specialization for three dimensional geometry::vector
+        template <typename T1, typename T2>
+            requires (geometry::are_vectors_v<T1, T2> && T1::dim == 3 && T2::dim == 3 && T1::flag == T2::flag)
+        struct cross_impl<T1, T2> {
+
+            using result_t = geometry::vector<multiply_t<typename T1::value_t, typename T2::value_t>, 3, T1::flag>;
+
+            static constexpr result_t f(const T1& x, const T2& y) noexcept {
+
+                result_t result;
+                result.data[0] = x.data[1] * y.data[2] - x.data[2] * y.data[1];
+                result.data[1] = x.data[2] * y.data[0] - x.data[0] * y.data[2];
+                result.data[2] = x.data[0] * y.data[1] - x.data[1] * y.data[0];
+
+                return result;
+
+            }
+
+        };
+
+
+    } // namespace op
+
+
+} // namespace scipp::math
@@ -0,0 +1,72 @@
+/**
+ * @file    scipp/math/algebraic/determinant.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the determinant of a square matrix
+ * @date    2023-08-02
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace op {
+
+
+        /// @brief Determinant specialization for expr_ptr, recorded as a single node keeping the factorization of the matrix
+        template <typename T>
+        struct determinant_impl<calculus::expr_ptr<T>> {
+
+            using result_t = calculus::expr_ptr<determinant_t<T>>;
+
+            static constexpr result_t f(const calculus::expr_ptr<T>& x) {
+
+                const geometry::lu_factorization<T> factors(x->val);
+
+                if (calculus::is_constant(x))
+                    return calculus::constant(factors.determinant());
+
+                return calculus::make_expr<calculus::determinant_expr<determinant_t<T>, T>>(factors.determinant(), x, factors);
+
+            }
+
+        };
+
+
+        template <typename T>
+        struct determinant_impl<calculus::variable<T>> {
+
+            using result_t = calculus::expr_ptr<determinant_t<T>>;
+
+            static constexpr result_t f(const calculus::variable<T>& x) {
+
+                return determinant(x.expr);
+
+            }
+
+        };
+
+
+        /// @brief Determinant specialization for a square geometry::matrix of numbers, by its LU factorization
+        /// @note  The determinant of a singular matrix is zero.
+        template <typename T>
+            requires (geometry::is_matrix_v<T> && T::rows == T::columns && is_number_v<typename T::element_t>)
+        struct determinant_impl<T> {
+
+            using result_t = typename T::element_t;
+
+            static constexpr result_t f(const T& x) {
+
+                return geometry::lu_factorization<T>(x).determinant();
+
+            }
+
+        };
+
+
+    } // namespace op
+
+
+} // namespace scipp::math
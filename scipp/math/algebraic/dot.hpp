@@ -0,0 +1,177 @@
+/**
+ * @file    scipp/math/algebraic/dot.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the dot product of vectors and of the frobenius product of matrices
+ * @date    2023-08-01
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace op {
+
+
+        /// @brief Dot specialization for expr_ptrs, recorded as a single node
+        template <typename T1, typename T2>
+        struct dot_impl<calculus::expr_ptr<T1>, calculus::expr_ptr<T2>> {
+
+            using result_t = calculus::expr_ptr<dot_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::expr_ptr<T1>& x, const calculus::expr_ptr<T2>& y) noexcept {
+
+                return calculus::make_operation<calculus::dot_expr<dot_t<T1, T2>, T1, T2>>(dot(x->val, y->val), x, y);
+
+            }
+                    
+        };
+
+
+        /// @brief Dot specialization for expr_ptr and value
+        template <typename T1, typename T2>
+            requires (geometry::is_vector_v<T2> || geometry::is_matrix_v<T2>)
+        struct dot_impl<calculus::expr_ptr<T1>, T2> {
+
+            using result_t = calculus::expr_ptr<dot_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::expr_ptr<T1>& x, const T2& y) noexcept {
+                
+                return dot(x, calculus::constant<T2>(y));
+
+            }
+                    
+        };
+
+        template <typename T1, typename T2>
+            requires (geometry::is_vector_v<T1> || geometry::is_matrix_v<T1>)
+        struct dot_impl<T1, calculus::expr_ptr<T2>> {
+
+            using result_t = calculus::expr_ptr<dot_t<T1, T2>>;
+            
+            static constexpr result_t f(const T1& x, const calculus::expr_ptr<T2>& y) noexcept {
+                
+                return dot(calculus::constant<T1>(x), y);
+
+            }
+                    
+        };
+
+
+        /// @brief Dot specialization for variables
+        template <typename T1, typename T2>
+        struct dot_impl<calculus::variable<T1>, calculus::variable<T2>> {
+
+            using result_t = calculus::expr_ptr<dot_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::variable<T1>& x, const calculus::variable<T2>& y) noexcept {
+                
+                return dot(x.expr, y.expr);   
+
+            }
+                    
+        };
+
+        template <typename T1, typename T2>
+        struct dot_impl<calculus::variable<T1>, calculus::expr_ptr<T2>> {
+
+            using result_t = calculus::expr_ptr<dot_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::variable<T1>& x, const calculus::expr_ptr<T2>& y) noexcept {
+                
+                return dot(x.expr, y);   
+
+            }
+                    
+        };
+
+        template <typename T1, typename T2>
+        struct dot_impl<calculus::expr_ptr<T1>, calculus::variable<T2>> {
+
+            using result_t = calculus::expr_ptr<dot_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::expr_ptr<T1>& x, const calculus::variable<T2>& y) noexcept {
+                
+                return dot(x, y.expr);   
+
+            }
+                    
+        };
+
+
+        /// @brief Dot specialization for variable and value
+        template <typename T1, typename T2>
+            requires (geometry::is_vector_v<T2> || geometry::is_matrix_v<T2>)
+        struct dot_impl<calculus::variable<T1>, T2> {
+
+            using result_t = calculus::expr_ptr<dot_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::variable<T1>& x, const T2& y) noexcept {
+                
+                return dot(x.expr, y);   
+
+            }
+                    
+        };
+
+        template <typename T1, typename T2>
+            requires (geometry::is_vector_v<T1> || geometry::is_matrix_v<T1>)
+        struct dot_impl<T1, calculus::variable<T2>> {
+
+            using result_t = calculus::expr_ptr<dot_t<T1, T2>>;
+            
+            static constexpr result_t f(const T1& x, const calculus::variable<T2>& y) noexcept {
+                
+                return dot(x, y.expr);   
+
+            }
+                    
+        };
+
+
+        /// @brief Dot specialization for geometry::vector of the same dimension
+        template <typename T1, typename T2>
+            requires (geometry::are_vectors_v<T1, T2> && T1::dim == T2::dim)
+        struct dot_impl<T1, T2> {
+
+            using result_t = multiply_t<typename T1::value_t, typename T2::value_t>;
+
+            static constexpr result_t f(const T1& x, const T2& y) noexcept {
+
+                result_t result = x.data[0] * y.data[0];
+                for (size_t i{1}; i < T1::dim; ++i)
+                    result += x.data[i] * y.data[i];
+
+                return result;
+
+            }
+
+        };
+
+
+        /// @brief Dot specialization for geometry::matrix of the same shape, as the sum of the dot products of their columns
+        template <typename T1, typename T2>
+            requires (geometry::are_matrix_v<T1, T2> && T1::rows == T2::rows && T1::columns == T2::columns)
+        struct dot_impl<T1, T2> {
+
+            using result_t = multiply_t<typename T1::element_t, typename T2::element_t>;
+
+            static constexpr result_t f(const T1& x, const T2& y) noexcept {
+
+                result_t result = dot(x.data[0], y.data[0]);
+                for (size_t j{1}; j < T1::columns; ++j)
+                    result += dot(x.data[j], y.data[j]);
+
+                return result;
+
+            }
+
+        };
+
+
+    } // namespace op
+
+
+} // namespace scipp::math
@@ -0,0 +1,67 @@
+/**
+ * @file    scipp/math/algebraic/inverse.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the inverse of a square matrix
+ * @date    2023-08-02
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace op {
+
+
+        /// @brief Inverse specialization for expr_ptr, recorded as a single node
+        template <typename T>
+        struct inverse_impl<calculus::expr_ptr<T>> {
+
+            using result_t = calculus::expr_ptr<inverse_t<T>>;
+
+            static constexpr result_t f(const calculus::expr_ptr<T>& x) {
+
+                return calculus::make_operation<calculus::inverse_expr<inverse_t<T>, T>>(inverse(x->val), x);
+
+            }
+
+        };
+
+
+        template <typename T>
+        struct inverse_impl<calculus::variable<T>> {
+
+            using result_t = calculus::expr_ptr<inverse_t<T>>;
+
+            static constexpr result_t f(const calculus::variable<T>& x) {
+
+                return inverse(x.expr);
+
+            }
+
+        };
+
+
+        /// @brief Inverse specialization for a square geometry::matrix of numbers, by its LU factorization
+        /// @note  Throws a std::runtime_error if the matrix is singular.
+        template <typename T>
+            requires (geometry::is_matrix_v<T> && T::rows == T::columns && is_number_v<typename T::element_t>)
+        struct inverse_impl<T> {
+
+            using result_t = T;
+
+            static constexpr result_t f(const T& x) {
+
+                return geometry::lu_factorization<T>(x).inverse();
+
+            }
+
+        };
+
+
+    } // namespace op
+
+
+} // namespace scipp::math
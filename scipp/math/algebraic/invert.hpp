@@ -22,7 +22,7 @@ namespace scipp::math {
 
             static constexpr result_t f(const calculus::expr_ptr<T>& x) {
 
-                return std::make_shared<calculus::invert_expr<T>>(1.0 / x->val, x);
+                return calculus::make_operation<calculus::invert_expr<T>>(1.0 / x->val, x);
 
             }
 
@@ -153,6 +153,62 @@ namespace scipp::math {
         }; 
 
 
+        /// @brief Invert a matrix element by element
+        /// @note  It is the type of the derivatives w.r.t. a matrix, not its inverse: see op::inverse.
+        template <typename MATRIX_TYPE>
+            requires geometry::is_matrix_v<MATRIX_TYPE>
+        struct invert_impl<MATRIX_TYPE> {
+            
+            using result_t = geometry::matrix<invert_t<typename MATRIX_TYPE::value_t>, MATRIX_TYPE::columns>; 
+
+            static constexpr result_t f(const MATRIX_TYPE& x) {
+
+                result_t x_inv;
+                for (size_t j{}; j < MATRIX_TYPE::columns; ++j)
+                    x_inv.data[j] = inv(x.data[j]);
+
+                return x_inv;
+
+            }        
+
+
+        }; 
+
+
+
+        /// @brief Invert specialization for dual numbers
+        template <typename T>
+            requires is_dual_v<T>
+        struct invert_impl<T> {
+
+            using result_t = dual<invert_t<typename T::value_t>, T::dim>;
+
+            static constexpr result_t f(const T& x) noexcept {
+
+                const auto inv_x = op::inv(x.real);
+                return x.chain(inv_x, op::neg(op::square(inv_x)));
+
+            }
+
+        };
+
+
+        /// @brief Invert specialization for static expressions
+        template <typename T>
+            requires calculus::is_static_expr_v<T>
+        struct invert_impl<T> {
+
+            using result_t = calculus::static_invert_expr<T>;
+
+            static constexpr result_t f(const T& x) noexcept {
+
+                return {x};
+
+            }
+
+        };
+
+
     } // namespace op
 
 
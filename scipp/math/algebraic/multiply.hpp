@@ -28,10 +28,40 @@ namespace scipp::math {
         struct multiply_impl<calculus::expr_ptr<T1>, calculus::expr_ptr<T2>> {
 
             using result_t = calculus::expr_ptr<multiply_t<T1, T2>>;
+
+            template <typename T>
+            inline static constexpr bool is_scalar_v = is_number_v<T> || physics::is_measurement_v<T>;
+
+            template <typename T>
+            inline static constexpr bool is_tensor_v = geometry::is_vector_v<T> || geometry::is_matrix_v<T>;
             
             static constexpr result_t f(const calculus::expr_ptr<T1>& x, const calculus::expr_ptr<T2>& y) noexcept {
+
+                if constexpr (std::is_same_v<multiply_t<T1, T2>, T1> && is_number_v<T2>)
+                    if (calculus::is_constant(y, T2{1}))
+                        return x;
+
+                if constexpr (std::is_same_v<multiply_t<T1, T2>, T2> && is_number_v<T1>)
+                    if (calculus::is_constant(x, T1{1}))
+                        return y;
+
+                using R = multiply_t<T1, T2>;
+
+                // the products of tensors are single nodes, propagating whole vectors and matrices
+                if constexpr (is_scalar_v<T1> && is_tensor_v<T2>)
+                    return calculus::make_operation<calculus::scale_expr<R, T1, T2>>(x->val * y->val, x, y);
+
+                else if constexpr (is_tensor_v<T1> && is_scalar_v<T2>)
+                    return calculus::make_operation<calculus::scale_expr<R, T2, T1>>(x->val * y->val, y, x);
+
+                else if constexpr (geometry::is_matrix_v<T1> && (geometry::is_column_vector_v<T2> || geometry::is_matrix_v<T2>))
+                    return calculus::make_operation<calculus::matvec_expr<R, T1, T2>>(x->val * y->val, x, y);
+
+                else if constexpr (geometry::is_row_vector_v<T1> && geometry::is_column_vector_v<T2>)
+                    return dot(x, y);
                 
-                return std::make_shared<calculus::multiply_expr<multiply_t<T1, T2>, T1, T2>>(x->val * y->val, x, y);
+                else
+                    return calculus::make_operation<calculus::multiply_expr<R, T1, T2>>(x->val * y->val, x, y);
 
             }
                     
@@ -41,7 +71,7 @@ namespace scipp::math {
         /// @tparam T1 
         /// @tparam T2 
         template <typename T1, typename T2>
-            requires (is_number_v<T2> || physics::is_measurement_v<T2> || geometry::is_vector_v<T2>)
+            requires (is_number_v<T2> || physics::is_measurement_v<T2> || geometry::is_vector_v<T2> || geometry::is_matrix_v<T2>)
         struct multiply_impl<calculus::expr_ptr<T1>, T2> {
 
             using result_t = calculus::expr_ptr<multiply_t<T1, T2>>;
@@ -55,7 +85,7 @@ namespace scipp::math {
         };
 
         template <typename T1, typename T2>
-            requires (is_number_v<T1> || physics::is_measurement_v<T1> || geometry::is_vector_v<T1>)
+            requires (is_number_v<T1> || physics::is_measurement_v<T1> || geometry::is_vector_v<T1> || geometry::is_matrix_v<T1>)
         struct multiply_impl<T1, calculus::expr_ptr<T2>> {
 
             using result_t = calculus::expr_ptr<multiply_t<T1, T2>>;
@@ -120,7 +150,7 @@ namespace scipp::math {
         /// @tparam T1 
         /// @tparam T2 
         template <typename T1, typename T2>
-            requires (is_number_v<T1> || physics::is_measurement_v<T1> || geometry::is_vector_v<T1>)
+            requires (is_number_v<T1> || physics::is_measurement_v<T1> || geometry::is_vector_v<T1> || geometry::is_matrix_v<T1>)
         struct multiply_impl<T1, calculus::variable<T2>> {
 
             using result_t = calculus::expr_ptr<multiply_t<T1, T2>>;
@@ -134,7 +164,7 @@ namespace scipp::math {
         };
 
         template <typename T1, typename T2>
-            requires (is_number_v<T2> || physics::is_measurement_v<T2> || geometry::is_vector_v<T2>)
+            requires (is_number_v<T2> || physics::is_measurement_v<T2> || geometry::is_vector_v<T2> || geometry::is_matrix_v<T2>)
         struct multiply_impl<calculus::variable<T1>, T2> {
 
             using result_t = calculus::expr_ptr<multiply_t<T1, T2>>;
@@ -198,54 +228,66 @@ namespace scipp::math {
         // };
 
 
-        // /// @brief Multiply specialization for dual numbers
-        // /// @tparam T1
-        // /// @tparam T2
-        // template <typename T1, typename T2>
-        //     requires (are_duals_v<T1, T2>)
-        // struct multiply_impl<T1, T2> {
+        /// @brief Multiply specialization for dual numbers
+        /// @tparam T1
+        /// @tparam T2
+        template <typename T1, typename T2>
+            requires (are_duals_v<T1, T2> && T1::dim == T2::dim)
+        struct multiply_impl<T1, T2> {
             
-        //     using result_t = dual<multiply_t<typename T1::value_t, typename T2::value_t>, multiply_t<typename T1::value_t, typename T2::value_t>>;
+            using result_t = dual<multiply_t<typename T1::value_t, typename T2::value_t>, T1::dim>;
 
-        //     static constexpr result_t f(const T1& x, const T2& y) noexcept {
+            static constexpr result_t f(const T1& x, const T2& y) noexcept {
 
-        //         return {x.real * y.real, x.real * y.imag + x.imag * y.real};
+                result_t result(op::mult(x.real, y.real));
+                for (size_t i{}; i < T1::dim; ++i)
+                    result.imag[i] = op::add(op::mult(x.imag[i], y.real), op::mult(x.real, y.imag[i]));
 
-        //     }
+                return result;
 
-        // };
+            }
 
+        };
 
-        // /// @brief Multiply specialization for dual numbers and numbers
-        // /// @tparam T1
-        // /// @tparam T2
-        // template <typename T1, typename T2>
-        //     requires (is_dual_v<T1> && is_number_v<T2>)
-        // struct multiply_impl<T1, T2> {
+
+        /// @brief Multiply specialization for dual numbers and numbers / physics::measurements
+        /// @tparam T1
+        /// @tparam T2
+        template <typename T1, typename T2>
+            requires (is_dual_v<T1> && (is_number_v<T2> || physics::is_measurement_v<T2>))
+        struct multiply_impl<T1, T2> {
             
-        //     using result_t = dual<multiply_t<typename T1::value_t, T2>, multiply_t<typename T1::value_t, T2>>;
+            using result_t = dual<multiply_t<typename T1::value_t, T2>, T1::dim>;
 
-        //     static constexpr result_t f(const T1& x, const T2& y) noexcept {
+            static constexpr result_t f(const T1& x, const T2& y) noexcept {
 
-        //         return {x.real * y, x.imag * y}; 
+                result_t result(op::mult(x.real, y));
+                for (size_t i{}; i < T1::dim; ++i)
+                    result.imag[i] = op::mult(x.imag[i], y);
 
-        //     }
+                return result;
 
-        // };
+            }
 
-        // template <typename T1, typename T2>
-        //     requires (is_number_v<T1> && is_dual_v<T2>)
-        // struct multiply_impl<T1, T2> {
+        };
+
+        template <typename T1, typename T2>
+            requires ((is_number_v<T1> || physics::is_measurement_v<T1>) && is_dual_v<T2>)
+        struct multiply_impl<T1, T2> {
             
-        //     using function_t = binary_function<T1, T2, dual<multiply_t<T1, typename T2::value_t>, multiply_t<typename T1::value_t, T2>>>;
+            using result_t = dual<multiply_t<T1, typename T2::value_t>, T2::dim>;
 
-        //     static constexpr result_t f(const function_t::first_arg_t& x, const T2& y) noexcept {
+            static constexpr result_t f(const T1& x, const T2& y) noexcept {
 
-        //         return {x * y.real, x * y.imag}; 
+                result_t result(op::mult(x, y.real));
+                for (size_t i{}; i < T2::dim; ++i)
+                    result.imag[i] = op::mult(x, y.imag[i]);
 
-        //     }
+                return result;
 
-        // };
+            }
+
+        };
 
 
         /// @brief Multiply specialization for numbers
@@ -552,7 +594,7 @@ namespace scipp::math {
         // };
 
         template <typename T1, typename T2>
-            requires ((geometry::are_row_vectors_v<T1> || geometry::are_column_vectors_v<T2>) && T1::dim == T2::dim)
+            requires ((geometry::are_row_vectors_v<T1, T2> || geometry::are_column_vectors_v<T1, T2>) && T1::dim == T2::dim)
         struct multiply_impl<T1, T2> {
             
             using result_t = geometry::vector<multiply_t<typename T1::value_t, typename T2::value_t>, T1::dim, T1::flag>;
@@ -595,7 +637,7 @@ namespace scipp::math {
         /// @tparam T1
         /// @tparam T2
         template <typename T1, typename T2>
-            requires ((physics::is_measurement_v<T1> || is_number_v<T1>) && geometry::is_vector_v<T2>)
+            requires ((physics::is_measurement_v<T1> || is_number_v<T1> || is_dual_v<T1>) && geometry::is_vector_v<T2>)
         struct multiply_impl<T1, T2> {
             
             using result_t = geometry::vector<multiply_t<T1, typename T2::value_t>, T2::dim, T2::flag>;
@@ -603,14 +645,8 @@ namespace scipp::math {
             static constexpr result_t f(const T1& x, const T2& y) noexcept {
                 
                 result_t result{};
-                std::transform(
-                    std::execution::par, 
-                    y.data.begin(), y.data.end(), 
-                    result.data.begin(), 
-                    [&x](const auto& y_i) { 
-                        return x * y_i; 
-                    }
-                );
+                for (size_t i{}; i < T2::dim; ++i)
+                    result.data[i] = x * y.data[i];
 
                 return result; 
 
@@ -619,7 +655,7 @@ namespace scipp::math {
         };
 
         template <typename T1, typename T2>
-            requires (geometry::is_vector_v<T1> && (physics::is_measurement_v<T2> || is_number_v<T2>))
+            requires (geometry::is_vector_v<T1> && (physics::is_measurement_v<T2> || is_number_v<T2> || is_dual_v<T2>))
         struct multiply_impl<T1, T2> {
             
             using result_t = geometry::vector<multiply_t<typename T1::value_t, T2>, T1::dim, T1::flag>;
@@ -627,14 +663,8 @@ namespace scipp::math {
             static constexpr result_t f(const T1& x, const T2& y) noexcept {
                 
                 result_t result{};
-                std::transform(
-                    std::execution::par, 
-                    x.data.begin(), x.data.end(), 
-                    result.data.begin(), 
-                    [&y](const auto& x_i) { 
-                        return x_i * y; 
-                    }
-                );
+                for (size_t i{}; i < T1::dim; ++i)
+                    result.data[i] = x.data[i] * y;
 
                 return result; 
 
@@ -643,64 +673,105 @@ namespace scipp::math {
         };
 
 
-        // /// @brief Multiply specialization for geometry::matrix
-        // /// @tparam T1
-        // /// @tparam T2
-        // template <typename T1, typename T2>
-        //     requires (geometry::are_matrix_v<T1, T2> && (T1::columns == T2::rows))
-        // struct multiply_impl<T1, T2> {
+        /// @brief Multiply specialization for geometry::matrix, column by column
+        /// @tparam T1
+        /// @tparam T2
+        template <typename T1, typename T2>
+            requires (geometry::are_matrix_v<T1, T2> && (T1::columns == T2::rows))
+        struct multiply_impl<T1, T2> {
             
-        //     using function_t = binary_function<T1, T2, geometry::matrix<geometry::column_vector<multiply_t<typename T1::value_t, typename T2::value_t>, T1::rows>, T2::columns>>;
+            using result_t = geometry::matrix<geometry::column_vector<multiply_t<typename T1::element_t, typename T2::element_t>, T1::rows>, T2::columns>;
 
-        //     static constexpr result_t f(const T1& x, const T2& y) noexcept {
+            static constexpr result_t f(const T1& x, const T2& y) noexcept {
 
-        //         typename result_t result;
-        //         const auto transposed = x.transpose();
-        //         for (size_t i{}; i < T2::columns; ++i)
-        //             for (size_t j{}; j < T1::rows; ++j)
-        //                 result.data[i][j] = op::dot(transposed.data[j], y.data[i]);
+                result_t result;
+                for (size_t j{}; j < T2::columns; ++j)
+                    result.data[j] = mult(x, y.data[j]);
 
-        //         return result; 
+                return result; 
 
-        //     }
+            }
         
-        // }; 
+        }; 
 
 
-        // /// @brief Multiply specialization for geometry::matrix and physics::measurements / generic numbers
-        // /// @tparam T1
-        // /// @tparam T2
-        // template <typename T1, typename T2>
-        //     requires ((physics::is_measurement_v<T1> || is_generic_number_v<T1>) && geometry::is_matrix_v<T2>)
-        // struct multiply_impl<T1, T2> {
+        /// @brief Multiply specialization for geometry::matrix and physics::measurements / generic numbers
+        /// @tparam T1
+        /// @tparam T2
+        template <typename T1, typename T2>
+            requires ((physics::is_measurement_v<T1> || is_number_v<T1>) && geometry::is_matrix_v<T2>)
+        struct multiply_impl<T1, T2> {
             
-        //     using function_t = binary_function<T1, T2, geometry::matrix<multiply_t<T1, typename T2::value_t>, T2::columns>>;
+            using result_t = geometry::matrix<multiply_t<T1, typename T2::value_t>, T2::columns>;
 
-        //     static constexpr result_t f(const function_t::first_arg_t& x, const T2& y) noexcept {
+            static constexpr result_t f(const T1& x, const T2& y) noexcept {
                 
-        //         typename result_t result;
-        //         std::transform(std::execution::par, y.data.begin(), y.data.end(), result.data.begin(), [&x](const auto& y_i) { return x * y_i; });
-        //         return result; 
+                result_t result;
+                for (size_t j{}; j < T2::columns; ++j)
+                    result.data[j] = op::mult(x, y.data[j]);
 
-        //     }
+                return result; 
+
+            }
         
-        // };
+        };
 
-        // template <typename T1, typename T2>
-        //     requires (geometry::is_matrix_v<T1> && (physics::is_measurement_v<T2> || is_generic_number_v<T1>))
-        // struct multiply_impl<T1, T2> {
+        template <typename T1, typename T2>
+            requires (geometry::is_matrix_v<T1> && (physics::is_measurement_v<T2> || is_number_v<T2>))
+        struct multiply_impl<T1, T2> {
             
-        //     using function_t = binary_function<T1, T2, geometry::matrix<multiply_t<typename T1::value_t, T2>, T1::columns>>;
+            using result_t = geometry::matrix<multiply_t<typename T1::value_t, T2>, T1::columns>;
 
-        //     static constexpr result_t f(const function_t::first_arg_t& x, const T2& y) noexcept {
+            static constexpr result_t f(const T1& x, const T2& y) noexcept {
                 
-        //         typename result_t result;
-        //         std::transform(std::execution::par, x.data.begin(), x.data.end(), result.data.begin(), [&y](const auto& x_i) { return x_i * y; });
-        //         return result; 
+                result_t result;
+                for (size_t j{}; j < T1::columns; ++j)
+                    result.data[j] = op::mult(x.data[j], y);
 
-        //     }
+                return result; 
+
+            }
         
-        // };
+        };
+
+
+        /// @brief Multiply specialization for geometry::matrix and geometry::vector, as the linear combination of the columns
+        /// @tparam T1
+        /// @tparam T2
+        template <typename T1, typename T2>
+            requires (geometry::is_matrix_v<T1> && geometry::is_column_vector_v<T2> && T1::columns == T2::dim)
+        struct multiply_impl<T1, T2> {
+            
+            using result_t = geometry::column_vector<multiply_t<typename T1::element_t, typename T2::value_t>, T1::rows>;
+
+            static constexpr result_t f(const T1& x, const T2& y) noexcept {
+                
+                result_t result{};
+                for (size_t j{}; j < T1::columns; ++j)
+                    for (size_t i{}; i < T1::rows; ++i)
+                        result.data[i] += x.data[j].data[i] * y.data[j];
+
+                return result; 
+
+            }
+        
+        };
+
+
+        /// @brief Multiply specialization for static expressions
+        template <typename T1, typename T2>
+            requires (calculus::is_static_expr_v<T1> || calculus::is_static_expr_v<T2>)
+        struct multiply_impl<T1, T2> {
+
+            using result_t = calculus::static_multiply_expr<calculus::static_t<T1>, calculus::static_t<T2>>;
+
+            static constexpr result_t f(const T1& x, const T2& y) noexcept {
+
+                return {calculus::to_static(x), calculus::to_static(y)};
+
+            }
+
+        };
 
 
     } // namespace op
@@ -20,7 +20,7 @@ namespace scipp::math {
             
             static constexpr calculus::expr_ptr<T> f(const calculus::expr_ptr<T>& x) noexcept {
                 
-                return std::make_shared<calculus::negate_expr<T>>(-x->val, x);
+                return calculus::make_operation<calculus::negate_expr<T>>(-x->val, x);
 
             }
                     
@@ -65,7 +65,7 @@ namespace scipp::math {
 
 
         template <typename T>
-            requires is_complex_v<T> || is_dual_v<T>
+            requires is_complex_v<T>
         struct negate_impl<T> {
 
             static constexpr T f(const T& x) noexcept {
@@ -114,6 +114,39 @@ namespace scipp::math {
         };
 
 
+
+        /// @brief Negate specialization for dual numbers
+        template <typename T>
+            requires is_dual_v<T>
+        struct negate_impl<T> {
+
+            static constexpr T f(const T& x) noexcept {
+
+                T result(op::neg(x.real));
+                for (size_t i{}; i < T::dim; ++i)
+                    result.imag[i] = op::neg(x.imag[i]);
+
+                return result;
+
+            }
+
+        };
+
+
+        /// @brief Negate specialization for static expressions
+        template <typename T>
+            requires calculus::is_static_expr_v<T>
+        struct negate_impl<T> {
+
+            static constexpr calculus::static_negate_expr<T> f(const T& x) noexcept {
+
+                return {x};
+
+            }
+
+        };
+
+
     } // namespace op
 
 
@@ -0,0 +1,158 @@
+/**
+ * @file    scipp/math/algebraic/outer.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the outer product of column vectors
+ * @date    2023-08-01
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace op {
+
+
+        /// @brief Outer specialization for expr_ptrs, recorded as a single node
+        template <typename T1, typename T2>
+        struct outer_impl<calculus::expr_ptr<T1>, calculus::expr_ptr<T2>> {
+
+            using result_t = calculus::expr_ptr<outer_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::expr_ptr<T1>& x, const calculus::expr_ptr<T2>& y) noexcept {
+
+                return calculus::make_operation<calculus::outer_expr<outer_t<T1, T2>, T1, T2>>(outer(x->val, y->val), x, y);
+
+            }
+                    
+        };
+
+
+        /// @brief Outer specialization for expr_ptr and value
+        template <typename T1, typename T2>
+            requires (geometry::is_vector_v<T2>)
+        struct outer_impl<calculus::expr_ptr<T1>, T2> {
+
+            using result_t = calculus::expr_ptr<outer_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::expr_ptr<T1>& x, const T2& y) noexcept {
+                
+                return outer(x, calculus::constant<T2>(y));
+
+            }
+                    
+        };
+
+        template <typename T1, typename T2>
+            requires (geometry::is_vector_v<T1>)
+        struct outer_impl<T1, calculus::expr_ptr<T2>> {
+
+            using result_t = calculus::expr_ptr<outer_t<T1, T2>>;
+            
+            static constexpr result_t f(const T1& x, const calculus::expr_ptr<T2>& y) noexcept {
+                
+                return outer(calculus::constant<T1>(x), y);
+
+            }
+                    
+        };
+
+
+        /// @brief Outer specialization for variables
+        template <typename T1, typename T2>
+        struct outer_impl<calculus::variable<T1>, calculus::variable<T2>> {
+
+            using result_t = calculus::expr_ptr<outer_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::variable<T1>& x, const calculus::variable<T2>& y) noexcept {
+                
+                return outer(x.expr, y.expr);   
+
+            }
+                    
+        };
+
+        template <typename T1, typename T2>
+        struct outer_impl<calculus::variable<T1>, calculus::expr_ptr<T2>> {
+
+            using result_t = calculus::expr_ptr<outer_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::variable<T1>& x, const calculus::expr_ptr<T2>& y) noexcept {
+                
+                return outer(x.expr, y);   
+
+            }
+                    
+        };
+
+        template <typename T1, typename T2>
+        struct outer_impl<calculus::expr_ptr<T1>, calculus::variable<T2>> {
+
+            using result_t = calculus::expr_ptr<outer_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::expr_ptr<T1>& x, const calculus::variable<T2>& y) noexcept {
+                
+                return outer(x, y.expr);   
+
+            }
+                    
+        };
+
+
+        /// @brief Outer specialization for variable and value
+        template <typename T1, typename T2>
+            requires (geometry::is_vector_v<T2>)
+        struct outer_impl<calculus::variable<T1>, T2> {
+
+            using result_t = calculus::expr_ptr<outer_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::variable<T1>& x, const T2& y) noexcept {
+                
+                return outer(x.expr, y);   
+
+            }
+                    
+        };
+
+        template <typename T1, typename T2>
+            requires (geometry::is_vector_v<T1>)
+        struct outer_impl<T1, calculus::variable<T2>> {
+
+            using result_t = calculus::expr_ptr<outer_t<T1, T2>>;
+            
+            static constexpr result_t f(const T1& x, const calculus::variable<T2>& y) noexcept {
+                
+                return outer(x, y.expr);   
+
+            }
+                    
+        };
+
+
+        /// @brief Outer specialization for geometry::column_vector, the matrix whose j-th column is x * y_j
+        template <typename T1, typename T2>
+            requires (geometry::are_column_vectors_v<T1, T2>)
+        struct outer_impl<T1, T2> {
+
+            using result_t = geometry::matrix<geometry::column_vector<multiply_t<typename T1::value_t, typename T2::value_t>, T1::dim>, T2::dim>;
+
+            static constexpr result_t f(const T1& x, const T2& y) noexcept {
+
+                result_t result;
+                for (size_t j{}; j < T2::dim; ++j)
+                    for (size_t i{}; i < T1::dim; ++i)
+                        result.data[j].data[i] = x.data[i] * y.data[j];
+
+                return result;
+
+            }
+
+        };
+
+
+    } // namespace op
+
+
+} // namespace scipp::math
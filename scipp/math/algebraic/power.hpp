@@ -25,7 +25,7 @@ namespace scipp::math {
 
             inline static constexpr result_t f(const calculus::expr_ptr<T>& x) {
 
-                return std::make_shared<calculus::power_expr<N, T>>(op::pow<N>(x->val), x);
+                return calculus::make_operation<calculus::power_expr<N, T>>(op::pow<N>(x->val), x);
 
             }
 
@@ -220,6 +220,39 @@ namespace scipp::math {
         }; 
 
 
+
+        /// @brief Power specialization for dual numbers
+        template <int N, typename T>
+            requires is_dual_v<T>
+        struct power_impl<N, T> {
+
+            using result_t = dual<power_t<N, typename T::value_t>, T::dim>;
+
+            static constexpr result_t f(const T& x) noexcept {
+
+                return x.chain(op::pow<N>(x.real), op::mult(static_cast<double>(N), op::pow<N - 1>(x.real)));
+
+            }
+
+        };
+
+
+        /// @brief Power specialization for static expressions
+        template <int N, typename T>
+            requires calculus::is_static_expr_v<T>
+        struct power_impl<N, T> {
+
+            using result_t = calculus::static_power_expr<N, T>;
+
+            static constexpr result_t f(const T& x) noexcept {
+
+                return {x};
+
+            }
+
+        };
+
+
     } // namespace op
 
 
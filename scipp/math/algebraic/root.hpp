@@ -80,7 +80,13 @@ namespace scipp::math {
 
             static constexpr result_t f(const T& x) noexcept {
 
-                return std::pow(x, 1.0 / POWER);
+                // the odd roots of negative numbers are real
+                if constexpr (POWER == 3)
+                    return std::cbrt(x);
+                else if constexpr (POWER % 2)
+                    return std::copysign(std::pow(std::abs(x), 1.0 / POWER), x);
+                else
+                    return std::pow(x, 1.0 / POWER);
 
             }       
 
@@ -96,7 +102,7 @@ namespace scipp::math {
 
             static constexpr result_t f(const MEAS_TYPE& x) noexcept {
 
-                return std::pow(x.value, 1.0 / POWER);
+                return root_impl<POWER, typename MEAS_TYPE::value_t>::f(x.value);
 
             }       
 
@@ -176,7 +182,7 @@ namespace scipp::math {
 
             static constexpr result_t f(const calculus::expr_ptr<T>& x) {
 
-                return std::make_shared<calculus::root_expr<N, T>>(op::root<N>(x->val), x);
+                return calculus::make_operation<calculus::root_expr<N, T>>(op::root<N>(x->val), x);
 
             }
 
@@ -197,6 +203,40 @@ namespace scipp::math {
         };
 
 
+
+        /// @brief Root specialization for dual numbers
+        template <int N, typename T>
+            requires is_dual_v<T>
+        struct root_impl<N, T> {
+
+            using result_t = dual<root_t<N, typename T::value_t>, T::dim>;
+
+            static constexpr result_t f(const T& x) noexcept {
+
+                const auto root_x = op::root<N>(x.real);
+                return x.chain(root_x, op::div(root_x, op::mult(static_cast<double>(N), x.real)));
+
+            }
+
+        };
+
+
+        /// @brief Root specialization for static expressions
+        template <int N, typename T>
+            requires calculus::is_static_expr_v<T>
+        struct root_impl<N, T> {
+
+            using result_t = calculus::static_root_expr<N, T>;
+
+            static constexpr result_t f(const T& x) noexcept {
+
+                return {x};
+
+            }
+
+        };
+
+
     } // namespace functions
 
 
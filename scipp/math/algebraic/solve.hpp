@@ -0,0 +1,162 @@
+/**
+ * @file    scipp/math/algebraic/solve.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the solution of a linear system
+ * @date    2023-08-02
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace op {
+
+
+        /// @brief Solve specialization for expr_ptrs, recorded as a single node keeping the factorization of the matrix
+        template <typename T1, typename T2>
+        struct solve_impl<calculus::expr_ptr<T1>, calculus::expr_ptr<T2>> {
+
+            using result_t = calculus::expr_ptr<solve_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::expr_ptr<T1>& x, const calculus::expr_ptr<T2>& y) {
+
+                const geometry::lu_factorization<T1> factors(x->val);
+
+                if (calculus::is_constant(x) && calculus::is_constant(y))
+                    return calculus::constant(factors.solve(y->val));
+
+                return calculus::make_expr<calculus::solve_expr<solve_t<T1, T2>, T1, T2>>(factors.solve(y->val), x, y, factors);
+
+            }
+                    
+        };
+
+
+        template <typename T1, typename T2>
+            requires (geometry::is_vector_v<T2> || geometry::is_matrix_v<T2>)
+        struct solve_impl<calculus::expr_ptr<T1>, T2> {
+
+            using result_t = calculus::expr_ptr<solve_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::expr_ptr<T1>& x, const T2& y) {
+                
+                return solve(x, calculus::constant<T2>(y));
+
+            }
+                    
+        };
+
+
+        template <typename T1, typename T2>
+            requires (geometry::is_vector_v<T1> || geometry::is_matrix_v<T1>)
+        struct solve_impl<T1, calculus::expr_ptr<T2>> {
+
+            using result_t = calculus::expr_ptr<solve_t<T1, T2>>;
+            
+            static constexpr result_t f(const T1& x, const calculus::expr_ptr<T2>& y) {
+                
+                return solve(calculus::constant<T1>(x), y);
+
+            }
+                    
+        };
+
+
+        template <typename T1, typename T2>
+        struct solve_impl<calculus::variable<T1>, calculus::variable<T2>> {
+
+            using result_t = calculus::expr_ptr<solve_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::variable<T1>& x, const calculus::variable<T2>& y) {
+                
+                return solve(x.expr, y.expr);
+
+            }
+                    
+        };
+
+
+        template <typename T1, typename T2>
+        struct solve_impl<calculus::variable<T1>, calculus::expr_ptr<T2>> {
+
+            using result_t = calculus::expr_ptr<solve_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::variable<T1>& x, const calculus::expr_ptr<T2>& y) {
+                
+                return solve(x.expr, y);
+
+            }
+                    
+        };
+
+
+        template <typename T1, typename T2>
+        struct solve_impl<calculus::expr_ptr<T1>, calculus::variable<T2>> {
+
+            using result_t = calculus::expr_ptr<solve_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::expr_ptr<T1>& x, const calculus::variable<T2>& y) {
+                
+                return solve(x, y.expr);
+
+            }
+                    
+        };
+
+
+        template <typename T1, typename T2>
+            requires (geometry::is_vector_v<T2> || geometry::is_matrix_v<T2>)
+        struct solve_impl<calculus::variable<T1>, T2> {
+
+            using result_t = calculus::expr_ptr<solve_t<T1, T2>>;
+            
+            static constexpr result_t f(const calculus::variable<T1>& x, const T2& y) {
+                
+                return solve(x.expr, y);
+
+            }
+                    
+        };
+
+
+        template <typename T1, typename T2>
+            requires (geometry::is_vector_v<T1> || geometry::is_matrix_v<T1>)
+        struct solve_impl<T1, calculus::variable<T2>> {
+
+            using result_t = calculus::expr_ptr<solve_t<T1, T2>>;
+            
+            static constexpr result_t f(const T1& x, const calculus::variable<T2>& y) {
+                
+                return solve(x, y.expr);
+
+            }
+                    
+        };
+
+
+        /// @brief Solve specialization for a square geometry::matrix of numbers and a column vector or a matrix, by its LU factorization
+        /// @note  Throws a std::runtime_error if the matrix is singular.
+        template <typename T1, typename T2>
+            requires (geometry::is_matrix_v<T1> && T1::rows == T1::columns && is_number_v<typename T1::element_t> && 
+                      (std::is_same_v<T2, typename T1::value_t> || 
+                       (geometry::is_matrix_v<T2> && std::is_same_v<typename T2::value_t, typename T1::value_t>)))
+        struct solve_impl<T1, T2> {
+
+            using result_t = T2;
+
+            static constexpr result_t f(const T1& x, const T2& y) {
+
+                return geometry::lu_factorization<T1>(x).solve(y);
+
+            }
+
+        };
+
+
+    } // namespace op
+
+
+} // namespace scipp::math
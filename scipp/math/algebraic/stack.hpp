@@ -0,0 +1,122 @@
+/**
+ * @file    scipp/math/algebraic/stack.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the functions stacking the components of a vector into a single expression, 
+ *          and extracting them back
+ * @date    2023-08-01
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace op {
+
+
+        /// @brief Stack specialization for geometry::vector of expr_ptrs, recorded as a single vector node
+        template <typename E, size_t DIM, bool FLAG>
+        struct stack_impl<geometry::vector<calculus::expr_ptr<E>, DIM, FLAG>> {
+
+            using value_t = geometry::vector<E, DIM, FLAG>;
+
+            using result_t = calculus::expr_ptr<value_t>;
+
+            static constexpr result_t f(const geometry::vector<calculus::expr_ptr<E>, DIM, FLAG>& x) noexcept {
+
+                value_t value;
+                for (size_t i{}; i < DIM; ++i)
+                    value.data[i] = x.data[i]->val;
+
+                if (std::ranges::all_of(x.data, [](const auto& xi) { return calculus::is_constant(xi); }))
+                    return calculus::constant<value_t>(value);
+
+                return calculus::make_expr<calculus::stack_expr<value_t, E>>(value, x.data);
+
+            }
+
+        };
+
+
+        /// @brief Stack specialization for geometry::vector of variables
+        template <typename E, size_t DIM, bool FLAG>
+        struct stack_impl<geometry::vector<calculus::variable<E>, DIM, FLAG>> {
+
+            using result_t = calculus::expr_ptr<geometry::vector<E, DIM, FLAG>>;
+
+            static constexpr result_t f(const geometry::vector<calculus::variable<E>, DIM, FLAG>& x) noexcept {
+
+                geometry::vector<calculus::expr_ptr<E>, DIM, FLAG> exprs;
+                for (size_t i{}; i < DIM; ++i)
+                    exprs.data[i] = x.data[i].expr;
+
+                return stack(exprs);
+
+            }
+
+        };
+
+
+        /// @brief Component specialization for expr_ptr of a geometry::vector
+        /// @note  Throws a std::out_of_range if the index is not less than the dimension of the vector.
+        template <typename T>
+            requires geometry::is_vector_v<T>
+        struct component_impl<calculus::expr_ptr<T>> {
+
+            using result_t = calculus::expr_ptr<typename T::value_t>;
+
+            static constexpr result_t f(const calculus::expr_ptr<T>& x, size_t i) {
+
+                if (i >= T::dim)
+                    throw std::out_of_range("The index of the component is out of the dimension of the vector.");
+
+                if (calculus::is_constant(x))
+                    return calculus::constant<typename T::value_t>(x->val.data[i]);
+
+                return calculus::make_expr<calculus::component_expr<typename T::value_t, T>>(x->val.data[i], x, i);
+
+            }
+
+        };
+
+
+        template <typename T>
+            requires geometry::is_vector_v<T>
+        struct component_impl<calculus::variable<T>> {
+
+            using result_t = calculus::expr_ptr<typename T::value_t>;
+
+            static constexpr result_t f(const calculus::variable<T>& x, size_t i) {
+
+                return component(x.expr, i);
+
+            }
+
+        };
+
+
+        /// @brief Component specialization for geometry::vector
+        template <typename T>
+            requires geometry::is_vector_v<T>
+        struct component_impl<T> {
+
+            using result_t = typename T::value_t;
+
+            static constexpr result_t f(const T& x, size_t i) {
+
+                if (i >= T::dim)
+                    throw std::out_of_range("The index of the component is out of the dimension of the vector.");
+
+                return x.data[i];
+
+            }
+
+        };
+
+
+    } // namespace op
+
+
+} // namespace scipp::math
@@ -0,0 +1,90 @@
+/**
+ * @file    scipp/math/algebraic/transpose.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the transpose of vectors and matrices
+ * @date    2023-08-01
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace op {
+
+
+        /// @brief Transpose specialization for expr_ptr, recorded as a single node
+        template <typename T>
+        struct transpose_impl<calculus::expr_ptr<T>> {
+
+            using result_t = calculus::expr_ptr<transpose_t<T>>;
+
+            static constexpr result_t f(const calculus::expr_ptr<T>& x) noexcept {
+
+                return calculus::make_operation<calculus::transpose_expr<transpose_t<T>, T>>(transpose(x->val), x);
+
+            }
+
+        };
+
+
+        template <typename T>
+        struct transpose_impl<calculus::variable<T>> {
+
+            using result_t = calculus::expr_ptr<transpose_t<T>>;
+
+            static constexpr result_t f(const calculus::variable<T>& x) noexcept {
+
+                return transpose(x.expr);
+
+            }
+
+        };
+
+
+        /// @brief Transpose specialization for geometry::vector, turning a column vector into a row vector and viceversa
+        template <typename T>
+            requires geometry::is_vector_v<T>
+        struct transpose_impl<T> {
+
+            using result_t = geometry::vector<typename T::value_t, T::dim, !T::flag>;
+
+            static constexpr result_t f(const T& x) noexcept {
+
+                result_t result;
+                result.data = x.data;
+
+                return result;
+
+            }
+
+        };
+
+
+        /// @brief Transpose specialization for geometry::matrix
+        template <typename T>
+            requires geometry::is_matrix_v<T>
+        struct transpose_impl<T> {
+
+            using result_t = geometry::matrix<geometry::column_vector<typename T::element_t, T::columns>, T::rows>;
+
+            static constexpr result_t f(const T& x) noexcept {
+
+                result_t result;
+                for (size_t j{}; j < T::columns; ++j)
+                    for (size_t i{}; i < T::rows; ++i)
+                        result.data[i].data[j] = x.data[j].data[i];
+
+                return result;
+
+            }
+
+        };
+
+
+    } // namespace op
+
+
+} // namespace scipp::math
@@ -0,0 +1,276 @@
+/**
+ * @file    math/calculus/adjoints.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the buffer storing the adjoints of a reverse sweep.
+ * @date    2023-07-25
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief The adjoints of the nodes reached by a reverse sweep, stored outside of the nodes.
+        /// @note  A buffer is active on the calling thread from its construction to its destruction, and the nodes
+        ///        accumulate their adjoints in the active buffer: since the nodes are only read by a reverse sweep,
+        ///        the same graph can be differentiated concurrently by different threads, each one with its buffer.
+        ///        The adjoints of a node of type T are stored as erased_t<T>, without units.
+        ///        The buffers nest, so that a sweep can be started while another one is running on the same thread.
+        ///        The slots of the adjoints are pooled, so that the ones forgotten by clear() are reused by the next sweep, 
+        ///        on top of the memory resource selected on the tape of the thread constructing the buffer, if any, 
+        ///        otherwise of the default resource.
+        struct adjoint_buffer {
+
+
+            std::pmr::unsynchronized_pool_resource pool; ///< The memory of the slots.
+
+            std::pmr::unordered_map<const expr_base*, void*> slots; ///< The adjoint of every reached node.
+
+            arena memory; ///< The memory of the adjoints.
+
+            adjoint_buffer* previous; ///< The buffer active on this thread before this one.
+
+            bool restricted{false}; ///< Whether only the activated nodes are given an adjoint.
+
+
+            /// Construct a buffer, active on the calling thread until it is destroyed.
+            adjoint_buffer() : pool(selected_resource()), slots(&pool), previous(active()) { active() = this; }
+
+            /// Construct a buffer without activating it, allocating its slots from a given memory resource.
+            explicit adjoint_buffer(std::nullptr_t, std::pmr::memory_resource* resource = selected_resource()) : 
+                pool(resource), slots(&pool), previous(nullptr) {}
+
+            adjoint_buffer(const adjoint_buffer&) = delete;
+
+            adjoint_buffer& operator=(const adjoint_buffer&) = delete;
+
+            ~adjoint_buffer() { 
+
+                if (active() == this)
+                    active() = previous; 
+
+            }
+
+
+            /// Return the pointer to the buffer active on the calling thread, if any.
+            static adjoint_buffer*& active() noexcept {
+
+                thread_local adjoint_buffer* current{nullptr};
+                return current;
+
+            }
+
+            /// Return the buffer active on the calling thread, or the default buffer of the thread if none is.
+            static adjoint_buffer& current() noexcept {
+
+                if (active())
+                    return *active();
+
+                thread_local adjoint_buffer fallback(nullptr, std::pmr::new_delete_resource());
+                return fallback;
+
+            }
+
+            /// Reserve the memory for the adjoints of a given number of nodes.
+            void reserve(size_t n) {
+
+                slots.reserve(n);
+
+            }
+
+            /// Forget all the adjoints, keeping their memory.
+            void clear() noexcept {
+
+                slots.clear();
+                memory.release();
+                restricted = false;
+
+            }
+
+
+            /// Give an adjoint only to some nodes, the ones active in the sweep, until the buffer is cleared.
+            void activate(const std::vector<expr_base*>& nodes) {
+
+                restricted = true;
+                slots.reserve(nodes.size());
+
+                for (auto node : nodes)
+                    slots.emplace(node, nullptr);
+
+            }
+
+
+            /// Return the adjoint of a node, initialized to zero when the node is first reached.
+            template <typename T>
+            erased_t<T>& at(const expr<T>* node) {
+
+                auto& slot = slots[node];
+
+                if (!slot)
+                    slot = this->make<erased_t<T>>();
+
+                return *static_cast<erased_t<T>*>(slot);
+
+            }
+
+            /// Return the pointer to the adjoint of a node, or nullptr if the buffer is restricted and the node is not active.
+            template <typename T>
+            erased_t<T>* find(const expr<T>* node) {
+
+                if (!restricted)
+                    return &this->at(node);
+
+                const auto slot = slots.find(node);
+
+                if (slot == slots.end())
+                    return nullptr;
+
+                if (!slot->second)
+                    slot->second = this->make<erased_t<T>>();
+
+                return static_cast<erased_t<T>*>(slot->second);
+
+            }
+
+            /// Return the pointer to the adjoint of a node, or nullptr if the node has not been reached, without giving it one.
+            /// @note  The nodes are only looked up, so the adjoints of different nodes can be read and written by different threads.
+            template <typename T>
+            erased_t<T>* peek(const expr<T>* node) const {
+
+                const auto slot = slots.find(node);
+
+                if (slot == slots.end())
+                    return nullptr;
+
+                return static_cast<erased_t<T>*>(slot->second);
+
+            }
+
+            /// Return whether a node has been given an adjoint.
+            bool reached(const expr_base* node) const {
+
+                const auto slot = slots.find(node);
+
+                return slot != slots.end() && slot->second;
+
+            }
+
+            /// Return the adjoint of a node, or zero if the node has not been reached.
+            template <typename T>
+            erased_t<T> value(const expr<T>* node) const {
+
+                const auto slot = slots.find(node);
+
+                if (slot == slots.end() || !slot->second)
+                    return erased_t<T>{};
+
+                return *static_cast<const erased_t<T>*>(slot->second);
+
+            }
+
+
+            /// Allocate a new adjoint initialized to zero.
+            template <typename T>
+            T* make() {
+
+                static_assert(std::is_trivially_destructible_v<T>, "The adjoints are released without being destroyed.");
+
+                return ::new (memory.allocate(sizeof(T), alignof(T))) T{};
+
+            }
+
+
+        }; /// struct adjoint_buffer
+
+
+        /// @brief The tangents of the nodes visited by a tangent sweep, stored outside of the nodes.
+        /// @note  As for the adjoints, a buffer is active on the calling thread from its construction to its destruction,
+        ///        and the nodes read and write their tangents in the active buffer, so that the same graph can be swept 
+        ///        forward by different threads at once.
+        struct tangent_buffer : adjoint_buffer {
+
+
+            /// Construct a buffer, active on the calling thread until it is destroyed.
+            tangent_buffer() : adjoint_buffer(nullptr) { 
+
+                this->previous = active(); 
+                active() = this; 
+
+            }
+
+            ~tangent_buffer() { 
+
+                if (active() == this)
+                    active() = static_cast<tangent_buffer*>(this->previous); 
+
+            }
+
+
+            /// Return the pointer to the tangent buffer active on the calling thread, if any.
+            static tangent_buffer*& active() noexcept {
+
+                thread_local tangent_buffer* current{nullptr};
+                return current;
+
+            }
+
+            /// Return the tangent buffer active on the calling thread, or the default buffer of the thread if none is.
+            static adjoint_buffer& current() noexcept {
+
+                if (active())
+                    return *active();
+
+                thread_local adjoint_buffer fallback(nullptr, std::pmr::new_delete_resource());
+                return fallback;
+
+            }
+
+
+        }; /// struct tangent_buffer
+
+
+        template <typename T>
+        typename expr<T>::adjoint_t& expr<T>::adjoint() {
+
+            return adjoint_buffer::current().at(this);
+
+        }
+
+        template <typename T>
+        typename expr<T>::adjoint_t* expr<T>::adjoint_ptr() {
+
+            return adjoint_buffer::current().find(this);
+
+        }
+
+        template <typename T>
+        typename expr<T>::adjoint_t& expr<T>::tangent() {
+
+            return tangent_buffer::current().at(this);
+
+        }
+
+        template <typename T>
+        void expr<T>::gather(adjoint_buffer& into, adjoint_buffer& from) {
+
+            if (adjoint_t* partial = from.peek(this)) {
+
+                if (adjoint_t* total = into.find(this))
+                    *total += *partial;
+
+                *partial = adjoint_t{};
+
+            }
+
+        }
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
@@ -58,6 +58,7 @@ namespace scipp::math {
             }
 
 
+            /// Return the velocity of the curve at a given parameter, as the jacobian-vector product along t.
             constexpr auto gradient(param_t& t) const {
 
                 return calculus::gradient(this->parametrization(t), t);
@@ -65,6 +66,7 @@ namespace scipp::math {
             }
 
             
+            /// Return the velocity of the curve at a given value of the parameter, as the jacobian-vector product along t.
             constexpr auto gradient(typename param_t::value_t t) const {
 
                 param_t t_var = t; 
@@ -0,0 +1,144 @@
+/**
+ * @file    scipp/math/calculus/differentiation/compile.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the compile function,
+ *          recording the graph of a variable once to evaluate it and its gradient many times.
+ * @date    2023-07-26
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief The program compiled from the graph of a variable of type T w.r.t. some variables of types Xs.
+        /// @note  The units are erased in the program and restored on the results, as for the adjoints.
+        template <typename T, typename... Xs>
+        struct compiled {
+
+
+            program prog; ///< The program of the graph.
+
+
+            /// Return the value of the graph at given values of the variables.
+            T eval(const Xs&... xs) noexcept {
+
+                this->load(xs...);
+                prog.run();
+
+                return adjoint_cast<T>(prog.values[prog.output]);
+
+            }
+
+
+            /// Return the derivatives of the graph w.r.t. the variables, at given values of the variables.
+            auto gradient(const Xs&... xs) noexcept {
+
+                constexpr auto N = sizeof...(Xs);
+                std::tuple<op::divide_t<T, Xs>...> values;
+
+                this->load(xs...);
+                prog.run();
+                prog.backpropagate();
+
+                meta::for_<N>([&](auto i) constexpr {
+                    using grad_t = std::tuple_element_t<i, decltype(values)>;
+                    std::get<i>(values) = adjoint_cast<grad_t>(prog.adjoints[prog.inputs[i]]);
+                });
+
+                if constexpr (N == 1)
+                    return std::get<0>(values);
+                else
+                    return values;
+
+            }
+
+
+            /// @brief The values of a variable at the points of a batch, without units.
+            template <typename>
+            using values_t = std::span<const double>;
+
+
+            /// Write the values of the graph at a batch of points in y, given the values of every variable at the points.
+            /// @note  The values are in the units of the base dimensions, as the erased types of T and Xs.
+            ///        Throws a std::invalid_argument if the values of a variable are not as many as the points in y.
+            void eval(std::span<double> y, values_t<Xs>... xs) {
+
+                const std::array<std::span<const double>, sizeof...(Xs)> points{xs...};
+                prog.run(y, points);
+
+            }
+
+
+            /// Write the values of the graph at a batch of points in y, and its derivatives w.r.t. every variable in grads,
+            /// given the values of every variable at the points.
+            /// @note  Throws a std::invalid_argument if the values or the derivatives of a variable are not as many as the points in y.
+            void gradient(std::span<double> y, const std::array<std::span<double>, sizeof...(Xs)>& grads, values_t<Xs>... xs) {
+
+                const std::array<std::span<const double>, sizeof...(Xs)> points{xs...};
+                prog.run(y, points, grads);
+
+            }
+
+
+            /// Return whether the branches recorded with the graph have been taken again at the last evaluation.
+            /// @note  When they have not, the graph has to be recorded and compiled again at the new values.
+            constexpr bool valid() const noexcept {
+
+                return prog.valid;
+
+            }
+
+
+            /// Write the values of the variables in the input slots.
+            constexpr void load(const Xs&... xs) noexcept {
+
+                size_t i{};
+                ((prog.values[prog.inputs[i++]] = static_cast<double>(adjoint_cast<erased_t<Xs>>(xs))), ...);
+
+            }
+
+
+        }; /// struct compiled
+
+
+        /// @brief Compile the graph of a variable y w.r.t. given variables, into a program evaluating y and its gradient.
+        /// @note  The comparisons between variables taken while recording on the tape of the calling thread
+        ///        are compiled as guards, checked at every evaluation. Only the comparisons of the nodes of the graph of y
+        ///        or of the variables, with each other or with values or constants of any type, are kept: the ones of other graphs are ignored.
+        ///        The comparisons are only seen while recording, so a graph built outside of a tape::scope has no guards.
+        template <typename T, typename... Vars>
+        auto compile(const variable<T>& y, const Wrt<Vars...>& wrt) {
+
+            const auto leaves = wrt.nodes();
+
+            auto nodes = topological_order(y.expr.get());
+            std::ranges::sort(nodes);
+
+            auto known = [&](const expr_base* node) {
+                return std::ranges::binary_search(nodes, node) || std::ranges::count(leaves, node) > 0;
+            };
+
+            auto constant = [](const expr_base* node) { return node->is_constant(); };
+
+            std::vector<branch> branches;
+            for (const auto& b : tape::local().branches) {
+
+                const auto l = b.l.get(), r = b.r.get();
+                if ((known(l) || known(r)) && (known(l) || constant(l)) && (known(r) || constant(r)))
+                    branches.push_back(b);
+
+            }
+
+            return compiled<T, typename std::decay_t<Vars>::value_t...>{program(y.expr.get(), leaves, branches)};
+
+        }
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
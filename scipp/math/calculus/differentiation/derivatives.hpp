@@ -20,6 +20,18 @@ namespace scipp::math {
 
             std::tuple<Vars...> args;
 
+
+            /// Return the expression nodes of the variables.
+            std::vector<expr_base*> nodes() const {
+
+                return std::apply(
+                    [](const auto&... x) {
+                        return std::vector<expr_base*>{x.expr.get()...};
+                    }, args
+                );
+
+            }
+
         };
 
         /// The keyword used to denote the variables *with respect to* the derivative is calculated.
@@ -32,60 +44,77 @@ namespace scipp::math {
 
 
         /// Return the derivatives of a dependent variable y with respect given independent variables.
+        /// @note  The adjoints are stored in a buffer owned by this call, so that the derivatives of graphs 
+        ///        sharing some nodes can be computed concurrently. Only the nodes on a path to the variables are swept.
         template <typename T, typename... Vars>
         constexpr auto derivatives(const variable<T>& y, const Wrt<Vars...>& wrt) {
             
             constexpr auto N = sizeof...(Vars);
             std::tuple<op::divide_t<T, typename std::decay_t<Vars>::value_t>...> values;
-    
+
+            adjoint_buffer adjoints;
+            active_sweep(active_nodes(y.expr.get(), wrt.nodes()), [&]() { y.expr->accumulate(1.0); });
+
             meta::for_<N>([&](auto i) constexpr {
                 using grad_t = std::tuple_element_t<i, decltype(values)>;
-                std::shared_ptr<grad_t> sharedPtr(&std::get<i>(values), [](grad_t*){});
-                std::get<i>(wrt.args).expr->bind_value(sharedPtr);
+                std::get<i>(values) = adjoint_cast<grad_t>(adjoints.value(std::get<i>(wrt.args).expr.get()));
             });
 
-            y.expr->propagate(std::make_shared<double>(1.0)); 
+            if constexpr (N == 1)
+                return std::get<0>(values);
+            else 
+                return values; 
 
-            meta::for_<N>([&](auto i) constexpr {
+        }
 
-                std::get<i>(wrt.args).expr->bind_value(nullptr);
 
-            });
+        /// Return the derivatives of a static expression y with respect given static variables.
+        /// @note  The derivatives are computed by the chain rule unrolled at compile time over the type of y.
+        template <typename E, typename... Vars>
+            requires is_static_expr_v<E>
+        constexpr auto derivatives(const E& y, const Wrt<Vars...>& wrt) noexcept {
 
+            constexpr auto N = sizeof...(Vars);
+
+            auto values = std::apply(
+                [&](const auto&... x) {
+                    return std::make_tuple(y.derivative(x)...);
+                }, wrt.args
+            );
 
             if constexpr (N == 1)
                 return std::get<0>(values);
-            else 
-                return values; 
+            else
+                return values;
 
         }
 
 
-        // /// Return the derivatives expr of a dependent variable y with respect given independent variables.
-        // template <typename T, typename... Vars>
-        // constexpr auto derivativesx(const variable<T>& y, const Wrt<Vars...>& wrt) {
-            
-        //     constexpr auto N = sizeof...(Vars);
-        //     std::tuple<variable<op::divide_t<T, typename std::decay_t<Vars>::value_t>>...> values;
-    
-        //     meta::for_<N>([&](auto i) constexpr {
-        //         using grad_t = std::tuple_element_t<i, decltype(values)>;
-        //         std::shared_ptr<expr_ptr<typename grad_t::value_t>> sharedPtr(&std::get<i>(values).expr, [](expr_ptr<typename grad_t::value_t>*){}); 
-        //         std::get<i>(wrt.args).expr->bind_expr(sharedPtr);
-        //     });
+        /// Return the derivatives of a dependent variable y with respect given independent variables, as variables.
+        /// @note  The derivatives are expressions of the variables y depends on, so they can be differentiated again.
+        template <typename T, typename... Vars>
+        constexpr auto derivativesx(const variable<T>& y, const Wrt<Vars...>& wrt) {
 
-        //     std::shared_ptr<std::shared_ptr<void>> sharedOne; 
-        //     y.expr->propagatex(sharedOne); 
+            constexpr auto N = sizeof...(Vars);
+            std::tuple<expr_ptr<typename std::decay_t<Vars>::value_t>...> exprs;
 
-        //     meta::for_<N>([&](auto i) constexpr {
+            const auto slots = std::apply([](auto&... e) { return std::array<void*, N>{&e...}; }, exprs);
+            collecting_sweepx(y.expr.get(), wrt.nodes(), slots, [&]() { y.expr->accumulatex(constant<T>(T{1.0})); });
 
-        //         std::get<i>(wrt.args).expr->bind_expr(nullptr);
+            std::tuple<variable<op::divide_t<T, typename std::decay_t<Vars>::value_t>>...> values;
 
-        //     });
+            meta::for_<N>([&](auto i) constexpr {
+                using grad_t = typename std::tuple_element_t<i, decltype(values)>::value_t;
+                const auto& e = std::get<i>(exprs);
+                std::get<i>(values) = e ? adjoint_castx<grad_t>(e) : constant<grad_t>(grad_t{});
+            });
 
-        //     return values; 
+            if constexpr (N == 1)
+                return std::get<0>(values);
+            else 
+                return values; 
 
-        // }
+        }
 
 
     } // namespace calculus
@@ -1,5 +1,5 @@
 /**
- * @file    scipp/math/calculus/variable.hpp
+ * @file    scipp/math/calculus/differentiation/gradient.hpp
  * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
  * @brief   This file contains the implementation
  * @date    2023-07-17
@@ -13,51 +13,66 @@ namespace scipp::math {
     namespace calculus {
 
 
-        template <typename T1, size_t DIM, bool FLAG, typename T2>
-        auto gradient(const geometry::vector<variable<T1>, DIM, FLAG>& y, const variable<T2>& x) {
+        /// @brief Write the gradient of a variable y w.r.t. a number of variables known at run time in a given buffer.
+        /// @param x The variables, as a span over any contiguous range of them.
+        /// @param grad The derivatives, as a span over a buffer of the same size of x.
+        /// @note  The derivatives are computed by a single sweep over the active nodes and written in place: 
+        ///        nothing is allocated for each variable. Throws a std::invalid_argument if the sizes are different.
+        template <typename T, typename V, size_t N, typename G, size_t M>
+            requires is_variable_v<std::remove_const_t<V>>
+        void gradient(const variable<T>& y, std::span<V, N> x, std::span<G, M> grad) {
 
-            using result_t = geometry::vector<op::divide_t<T1, T2>, DIM, FLAG>;
-            result_t result;
+            if (x.size() != grad.size())
+                throw std::invalid_argument("Cannot write the derivatives w.r.t. " + std::to_string(x.size()) + 
+                                            " variables in a buffer of size " + std::to_string(grad.size()) + ".");
 
-            meta::for_<DIM>([&](auto i) {
-                result.data[i.index] = derivatives(y.data[i.index], wrt(x));
-            });
+            std::vector<expr_base*> leaves(x.size());
+            std::ranges::transform(x, leaves.begin(), [](const auto& v) -> expr_base* { return v.expr.get(); });
 
-            return result;
+            adjoint_buffer adjoints;
+            active_sweep(active_nodes(y.expr.get(), leaves), [&]() { y.expr->accumulate(1.0); });
+
+            for (size_t i{}; i < x.size(); ++i)
+                grad[i] = adjoint_cast<G>(adjoints.value(x[i].expr.get()));
 
         }
 
-        template <typename T1, size_t DIM, bool FLAG, typename T2>
-        auto gradient(const geometry::vector<expr_ptr<T1>, DIM, FLAG>& y, const variable<T2>& x) {
 
-            using result_t = geometry::vector<op::divide_t<T1, T2>, DIM, FLAG>;
-            result_t result;
+        /// @brief Return the gradient of a variable y w.r.t. a vector of variables.
+        template <typename T, typename U, size_t DIM, bool FLAG>
+        auto gradient(const variable<T>& y, const geometry::vector<variable<U>, DIM, FLAG>& x) {
 
-            meta::for_<DIM>([&](auto i) {
-                variable v = y.data[i];
-                result.data[i] = derivatives(v, wrt(x));
-            });
+            geometry::vector<op::divide_t<T, U>, DIM, FLAG> result;
+            gradient(y, std::span(x.data), std::span(result.data));
 
             return result;
 
         }
 
-        template <typename T1, size_t DIM, bool FLAG, typename T2>
-        auto gradient(const geometry::vector<expr_ptr<T1>, DIM, FLAG>& y, const T2& x) {
 
-            using result_t = geometry::vector<op::divide_t<T1, T2>, DIM, FLAG>;
+        /// @brief Return the derivatives of a vector of dependent variables or expressions y w.r.t. a variable x.
+        /// @note  All the components are computed by a single forward sweep, as the jacobian-vector product along x.
+        template <typename E, size_t DIM, bool FLAG, typename T2>
+        auto gradient(const geometry::vector<E, DIM, FLAG>& y, const variable<T2>& x) {
+
+            using result_t = geometry::vector<op::divide_t<component_t<E>, T2>, DIM, FLAG>;
             result_t result;
-            variable<T2> var_x = x;
 
-            meta::for_<DIM>([&](auto i) {
-                variable v = y.data[i];
-                result.data[i] = derivatives(v, wrt(var_x));
-            });
+            const auto tangents = jvp(y, wrt(x), std::tuple<T2>{T2{1.0}});
+            for (size_t i{}; i < DIM; ++i)
+                result.data[i] = adjoint_cast<typename result_t::value_t>(tangents.data[i]);
 
             return result;
 
         }
 
+        template <typename E, size_t DIM, bool FLAG, typename T2>
+        auto gradient(const geometry::vector<E, DIM, FLAG>& y, const T2& x) {
+
+            return gradient(y, variable<T2>(x));
+
+        }
+
 
 
     } // namespace calculus
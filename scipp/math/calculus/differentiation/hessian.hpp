@@ -0,0 +1,85 @@
+/**
+ * @file    scipp/math/calculus/differentiation/hessian.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the hessian and of the hessian-vector product.
+ * @date    2023-07-23
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief Return the product of the hessian of a dependent variable y with respect to given variables and a vector v.
+        /// @param v The components of the vector, each one with the type of the corresponding variable.
+        /// @note  The gradient of y is built as an expression by a single reverse sweep, then its tangent along v is computed
+        ///        by a single forward sweep (forward over reverse), so the cost of a product is proportional to the graph of y.
+        template <typename T, typename... Vars>
+        auto hessian_vector_product(const variable<T>& y, const Wrt<Vars...>& wrt, const std::tuple<typename std::decay_t<Vars>::value_t...>& v) {
+
+            constexpr auto N = sizeof...(Vars);
+
+            auto grad = [&]() {
+                if constexpr (N == 1)
+                    return std::make_tuple(derivativesx(y, wrt));
+                else
+                    return derivativesx(y, wrt);
+            }();
+
+            std::vector<expr_base*> roots(N);
+            meta::for_<N>([&](auto i) constexpr {
+                roots[i] = std::get<i>(grad).expr.get();
+            });
+
+            std::unordered_map<expr_base*, std::function<void()>> seeds;
+            meta::for_<N>([&](auto j) constexpr {
+                constexpr size_t J = j;
+                auto x = std::get<J>(wrt.args).expr.get();
+                seeds[x] = [x, &v]() { x->tangent() = erase(std::get<J>(v)); };
+            });
+
+            tangent_buffer tangents;
+            tangent_sweep(topological_order(roots), [&](expr_base* node) {
+                if (seeds.contains(node))
+                    seeds.at(node)();
+            });
+
+            std::tuple<op::divide_t<T, typename std::decay_t<Vars>::value_t>...> values;
+
+            meta::for_<N>([&](auto i) constexpr {
+                using value_t = std::tuple_element_t<i, decltype(values)>;
+                std::get<i>(values) = adjoint_cast<value_t>(std::get<i>(grad).expr->tangent());
+            });
+
+            if constexpr (N == 1)
+                return std::get<0>(values);
+            else
+                return values;
+
+        }
+
+
+        /// @brief Return the hessian of a dependent variable y with respect to given variables of the same type.
+        /// @note  The gradient of y is built as an expression, then differentiated by the jacobian.
+        template <typename T, typename... Vars>
+            requires (sizeof...(Vars) > 1)
+        auto hessian(const variable<T>& y, const Wrt<Vars...>& wrt) {
+
+            using x_t = typename std::decay_t<std::tuple_element_t<0, std::tuple<Vars...>>>::value_t;
+
+            return std::apply(
+                [&](auto... grad) {
+                    return jacobian(geometry::vector<variable<op::divide_t<T, x_t>>, sizeof...(Vars)>{grad...}, wrt);
+                }, derivativesx(y, wrt)
+            );
+
+        }
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
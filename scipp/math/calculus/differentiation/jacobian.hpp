@@ -13,11 +13,116 @@ namespace scipp::math {
     namespace calculus {
 
 
-        template <typename VECTOR>
-        auto jacobian(const VECTOR& y)
+        /// @brief Return the columns of the jacobian of some dependent variables ys with respect to given variables.
+        /// @note  Every column is computed by a tangent sweep seeded along one variable, so the graph is sorted once
+        ///        and visited once per variable: this is the cheap mode when there are fewer variables than outputs.
+        ///        The tangents are kept in a buffer of the call, so that the nodes are only read.
+        template <typename Y, size_t M, bool FLAG, typename... Vars>
+        auto forward_jacobian(const geometry::vector<variable<Y>, M, FLAG>& ys, const Wrt<Vars...>& wrt) {
+
+            constexpr auto N = sizeof...(Vars);
+            std::tuple<geometry::vector<op::divide_t<Y, typename std::decay_t<Vars>::value_t>, M, FLAG>...> columns;
+
+            std::vector<expr_base*> roots(M);
+            for (size_t i{}; i < M; ++i)
+                roots[i] = ys.data[i].expr.get();
+
+            const auto order = topological_order(roots);
+            tangent_buffer tangents;
+
+            meta::for_<N>([&](auto j) constexpr {
+
+                using x_t = typename std::decay_t<std::tuple_element_t<j, std::tuple<Vars...>>>::value_t;
+                using column_t = std::tuple_element_t<j, decltype(columns)>;
+
+                auto x = std::get<j>(wrt.args).expr.get();
+
+                tangent_sweep(order, [&](expr_base* node) {
+                    if (node == x)
+                        x->tangent() = erase(x_t{1.0});
+                });
+
+                for (size_t i{}; i < M; ++i)
+                    std::get<j>(columns).data[i] = adjoint_cast<typename column_t::value_t>(ys.data[i].expr->tangent());
+
+            });
+
+            return columns;
+
+        }
+
+
+        /// @brief Return the columns of the jacobian of some dependent variables ys with respect to given variables.
+        /// @note  The graph of all the outputs is sorted once, then all the rows are computed by a single batched sweep 
+        ///        over the nodes on a path to the variables, seeding every output in a lane of its own: 
+        ///        this is the cheap mode when there are fewer outputs than variables.
+        template <typename Y, size_t M, bool FLAG, typename... Vars>
+        auto reverse_jacobian(const geometry::vector<variable<Y>, M, FLAG>& ys, const Wrt<Vars...>& wrt) {
+
+            constexpr auto N = sizeof...(Vars);
+            std::tuple<geometry::vector<op::divide_t<Y, typename std::decay_t<Vars>::value_t>, M, FLAG>...> columns;
+
+            std::vector<expr_base*> roots(M);
+            for (size_t i{}; i < M; ++i)
+                roots[i] = ys.data[i].expr.get();
+
+            const auto active = active_nodes(roots, wrt.nodes());
+
+            std::vector<std::unique_ptr<adjoint_buffer>> lanes;
+            std::vector<adjoint_buffer*> buffers;
+            for (size_t i{}; i < M; ++i) {
+
+                lanes.push_back(std::make_unique<adjoint_buffer>(nullptr));
+                buffers.push_back(lanes.back().get());
+
+            }
+
+            batched_sweep(active, std::span<adjoint_buffer* const>(buffers), [&](size_t i) { ys.data[i].expr->accumulate(1.0); });
+
+            for (size_t i{}; i < M; ++i)
+                meta::for_<N>([&](auto j) constexpr {
+                    using column_t = std::tuple_element_t<j, decltype(columns)>;
+                    std::get<j>(columns).data[i] = adjoint_cast<typename column_t::value_t>(buffers[i]->value(std::get<j>(wrt.args).expr.get()));
+                });
+
+            return columns;
+
+        }
+
+
+        /// @brief Return the jacobian of some dependent variables ys with respect to given variables.
+        /// @note  The forward mode is used when there are fewer variables than outputs, the reverse mode otherwise.
+        ///        When all the variables share the same type the result is a matrix, whose j-th column holds
+        ///        the derivatives of ys w.r.t. the j-th variable, otherwise it is the tuple of the columns.
+        template <typename Y, size_t M, bool FLAG, typename... Vars>
+        auto jacobian(const geometry::vector<variable<Y>, M, FLAG>& ys, const Wrt<Vars...>& wrt) {
+
+            constexpr auto N = sizeof...(Vars);
+
+            auto columns = [&]() {
+                if constexpr (N < M)
+                    return forward_jacobian(ys, wrt);
+                else
+                    return reverse_jacobian(ys, wrt);
+            }();
+
+            using column_t = std::tuple_element_t<0, decltype(columns)>;
+
+            if constexpr ((std::is_same_v<column_t, geometry::vector<op::divide_t<Y, typename std::decay_t<Vars>::value_t>, M, FLAG>> && ...)) {
+
+                return std::apply(
+                    [](auto&... column) {
+                        return geometry::matrix<column_t, N>(std::array<column_t, N>{std::move(column)...});
+                    }, columns
+                );
+
+            } else
+                return columns;
+
+        }
 
 
     } // namespace calculus
 
 
-} // namespace scipp::math
\ No newline at end of file
+} // namespace scipp::math
@@ -0,0 +1,367 @@
+/**
+ * @file    scipp/math/calculus/differentiation/parallel.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the reverse sweep of a wide expression graph over many threads,
+ *          scheduled by the levels of its nodes.
+ * @date    2023-08-01
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief The threads of a parallel sweep, started once and kept waiting for the next job.
+        /// @note  A job runs on every thread at once, and the calling thread waits for all of them to finish it.
+        ///        The jobs given by many threads run one at a time.
+        struct worker_pool {
+
+
+            std::mutex running; ///< Held while a job is running.
+
+            std::mutex lock; ///< Guards the job and the counters below.
+
+            std::condition_variable wake; ///< Notified when a job is given or the threads are stopped.
+
+            std::condition_variable done; ///< Notified when the last thread finishes the job.
+
+            std::function<void(size_t)> job; ///< The job, given the index of the thread running it.
+
+            size_t generation{}; ///< The number of jobs given.
+
+            size_t remaining{}; ///< The number of threads still running the job.
+
+            bool stopping{false}; ///< If the threads have to stop.
+
+            std::vector<std::jthread> workers; ///< The threads, joined first at destruction.
+
+
+            /// Start a given number of threads.
+            explicit worker_pool(size_t threads) {
+
+                workers.reserve(threads);
+                for (size_t k{}; k < threads; ++k)
+                    workers.emplace_back([this, k]() {
+
+                        size_t seen{};
+                        while (true) {
+
+                            {
+                                std::unique_lock guard(lock);
+                                wake.wait(guard, [&]() { return stopping || generation != seen; });
+                                if (stopping)
+                                    return;
+                                seen = generation;
+                            }
+
+                            job(k);
+
+                            std::lock_guard guard(lock);
+                            if (--remaining == 0)
+                                done.notify_one();
+
+                        }
+
+                    });
+
+            }
+
+            worker_pool(const worker_pool&) = delete;
+
+            worker_pool& operator=(const worker_pool&) = delete;
+
+            ~worker_pool() {
+
+                {
+                    std::lock_guard guard(lock);
+                    stopping = true;
+                }
+                wake.notify_all();
+
+            }
+
+
+            /// Return the number of threads.
+            size_t size() const noexcept {
+
+                return workers.size();
+
+            }
+
+
+            /// Run a job on every thread, and wait for all of them to finish it.
+            /// @note  The job must not throw.
+            void run(std::function<void(size_t)> task) {
+
+                std::lock_guard exclusive(running);
+
+                std::unique_lock guard(lock);
+                job = std::move(task);
+                remaining = workers.size();
+                ++generation;
+                wake.notify_all();
+
+                done.wait(guard, [&]() { return remaining == 0; });
+                job = nullptr;
+
+            }
+
+
+        }; /// struct worker_pool
+
+
+        /// @brief The schedule of a reverse sweep over many threads, from some root nodes to some leaves.
+        /// @note  The level of an active node is the length of the longest path from a root to it: the nodes of a level
+        ///        depend on the adjoints of the previous levels only, so they can be swept at once. Every level is split
+        ///        among the threads, each one accumulating the contributions of its nodes in a buffer of its own, and the
+        ///        partial adjoints of a node are gathered by the thread sweeping it, from the threads sweeping its parents.
+        ///        The schedule depends only on the structure of the graph, so it can be reused after the values are updated.
+        ///        Its threads are started with it and reused by every sweep, shared by its copies.
+        struct parallel_schedule {
+
+
+            /// @brief A node to sweep, and the range of the buffers holding its partial adjoints.
+            struct item {
+
+                expr_base* node;
+
+                size_t first, last;
+
+            }; /// struct item
+
+
+            size_t threads; ///< The number of threads of the sweep.
+
+            std::vector<expr_base*> roots; ///< The root nodes, seeded on the calling thread.
+
+            std::vector<expr_base*> leaves; ///< The leaves, whose adjoints are gathered on the calling thread.
+
+            std::vector<std::vector<std::vector<item>>> work; ///< The nodes swept by every thread at every level.
+
+            std::vector<std::vector<size_t>> sources; ///< The buffers every thread gathers from, the calling thread being the last one.
+
+            std::vector<std::vector<expr_base*>> touched; ///< The nodes given an adjoint in the buffer of every thread.
+
+            std::vector<std::pair<expr_base*, size_t>> owners; ///< The active leaves, and the threads sweeping them.
+
+            std::shared_ptr<worker_pool> pool; ///< The threads of the sweep.
+
+
+            /// Construct the schedule of the sweep from some root nodes to some leaves over a given number of threads.
+            parallel_schedule(const std::vector<expr_base*>& roots, const std::vector<expr_base*>& leaves,
+                              size_t threads = std::max(1u, std::thread::hardware_concurrency())) :
+                threads(std::max<size_t>(threads, 1)), roots(roots), leaves(leaves),
+                work(this->threads), sources(this->threads), touched(this->threads), 
+                pool(std::make_shared<worker_pool>(this->threads)) {
+
+                const auto active = active_nodes(roots, leaves);
+                const size_t n = active.size();
+
+                std::unordered_map<const expr_base*, size_t> position;
+                position.reserve(n);
+                for (size_t i{}; i < n; ++i)
+                    position.emplace(active[i], i);
+
+                // the active children of every node, stored contiguously
+                std::vector<size_t> offsets{0}, edges;
+                std::vector<expr_base*> children;
+                for (auto node : active) {
+
+                    children.clear();
+                    node->children(children);
+
+                    for (auto child : children)
+                        if (position.contains(child))
+                            edges.push_back(position.at(child));
+
+                    offsets.push_back(edges.size());
+
+                }
+
+                // the parents follow their children in the topological order, so they are leveled first
+                std::vector<size_t> level(n);
+                size_t levels{};
+                for (size_t i = n; i-- > 0; ) {
+
+                    for (size_t e = offsets[i]; e < offsets[i + 1]; ++e)
+                        level[edges[e]] = std::max(level[edges[e]], level[i] + 1);
+
+                    levels = std::max(levels, level[i] + 1);
+
+                }
+
+                std::vector<size_t> width(levels), rank(n);
+                for (size_t i{}; i < n; ++i)
+                    rank[i] = width[level[i]]++;
+
+                std::vector<size_t> owner(n);
+                for (size_t i{}; i < n; ++i)
+                    owner[i] = rank[i] * this->threads / width[level[i]];
+
+                // the buffers holding the partial adjoints of every node: the ones of its parents, and the caller for the roots
+                std::vector<std::vector<size_t>> from(n);
+                for (auto root : roots)
+                    if (position.contains(root))
+                        from[position.at(root)].push_back(this->threads);
+
+                for (size_t i{}; i < n; ++i) {
+
+                    touched[owner[i]].push_back(active[i]);
+
+                    for (size_t e = offsets[i]; e < offsets[i + 1]; ++e) {
+
+                        auto& buffers = from[edges[e]];
+                        if (owner[i] != owner[edges[e]] && std::ranges::count(buffers, owner[i]) == 0)
+                            buffers.push_back(owner[i]);
+
+                        touched[owner[i]].push_back(active[edges[e]]);
+
+                    }
+
+                }
+
+                for (size_t k{}; k < this->threads; ++k)
+                    work[k].resize(levels);
+
+                for (size_t i{}; i < n; ++i) {
+
+                    auto& list = sources[owner[i]];
+                    const size_t first = list.size();
+                    list.insert(list.end(), from[i].begin(), from[i].end());
+                    work[owner[i]][level[i]].push_back({active[i], first, list.size()});
+
+                }
+
+                for (auto leaf : leaves)
+                    if (position.contains(leaf))
+                        owners.emplace_back(leaf, owner[position.at(leaf)]);
+
+            }
+
+
+            /// Return the number of levels of the sweep.
+            size_t levels() const noexcept {
+
+                return work.front().size();
+
+            }
+
+
+        }; /// struct parallel_schedule
+
+
+        /// @brief Propagate the adjoints from the roots to the leaves of a schedule over its threads.
+        /// @param seed The function seeding the adjoints of the root nodes.
+        /// @note  The roots are seeded and the adjoints of the leaves are gathered in the adjoint buffer active on
+        ///        the calling thread, which is cleared first: the adjoints of the other nodes are dropped with the buffers
+        ///        of the threads. The threads wait for each other at the end of every level.
+        ///        The threads of the schedule are reused, so the sweeps with the same schedule run one at a time.
+        ///        If the sweep of a node throws, the remaining levels are skipped and the first exception is rethrown.
+        ///        The buffers of the threads are allocated from the default heap, since the resource of a tape::allocation
+        ///        may not be synchronized.
+        template <typename F>
+        void parallel_sweep(const parallel_schedule& schedule, F&& seed) {
+
+            auto& adjoints = adjoint_buffer::current();
+            adjoints.clear();
+            adjoints.activate(schedule.roots);
+            adjoints.activate(schedule.leaves);
+
+            std::invoke(std::forward<F>(seed));
+
+            std::vector<std::unique_ptr<adjoint_buffer>> partials;
+            std::vector<adjoint_buffer*> buffers;
+            for (size_t k{}; k < schedule.threads; ++k) {
+
+                partials.push_back(std::make_unique<adjoint_buffer>(nullptr, std::pmr::new_delete_resource()));
+                buffers.push_back(partials.back().get());
+
+            }
+            buffers.push_back(&adjoints);
+
+            std::barrier sync(static_cast<std::ptrdiff_t>(schedule.threads));
+            std::atomic<bool> failed{false};
+            std::exception_ptr error;
+
+            schedule.pool->run([&](size_t k) {
+
+                auto& buffer = *buffers[k];
+                buffer.activate(schedule.touched[k]);
+
+                adjoint_buffer::active() = &buffer;
+
+                for (const auto& level : schedule.work[k]) {
+
+                    if (!failed)
+                        try {
+
+                            for (const auto& [node, first, last] : level) {
+
+                                for (size_t s = first; s < last; ++s)
+                                    node->gather(buffer, *buffers[schedule.sources[k][s]]);
+
+                                node->backward();
+
+                            }
+
+                        } catch (...) {
+
+                            if (!failed.exchange(true))
+                                error = std::current_exception();
+
+                        }
+
+                    sync.arrive_and_wait();
+
+                }
+
+                adjoint_buffer::active() = nullptr;
+
+            });
+
+            if (error)
+                std::rethrow_exception(error);
+
+            for (const auto& [leaf, owner] : schedule.owners)
+                leaf->gather(adjoints, *buffers[owner]);
+
+        }
+
+
+        /// Return the derivatives of a dependent variable y with respect given independent variables, sweeping over many threads.
+        /// @param schedule The schedule of the sweep, built from y and the wrt variables.
+        /// @note  Throws a std::invalid_argument if the schedule does not start from y.
+        template <typename T, typename... Vars>
+        auto derivatives(const parallel_schedule& schedule, const variable<T>& y, const Wrt<Vars...>& wrt) {
+
+            if (std::ranges::count(schedule.roots, y.expr.get()) == 0)
+                throw std::invalid_argument("The schedule of the sweep does not start from the given variable.");
+
+            constexpr auto N = sizeof...(Vars);
+            std::tuple<op::divide_t<T, typename std::decay_t<Vars>::value_t>...> values;
+
+            adjoint_buffer adjoints;
+            parallel_sweep(schedule, [&]() { y.expr->accumulate(1.0); });
+
+            meta::for_<N>([&](auto i) constexpr {
+                using grad_t = std::tuple_element_t<i, decltype(values)>;
+                std::get<i>(values) = adjoint_cast<grad_t>(adjoints.value(std::get<i>(wrt.args).expr.get()));
+            });
+
+            if constexpr (N == 1)
+                return std::get<0>(values);
+            else
+                return values;
+
+        }
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
@@ -0,0 +1,91 @@
+/**
+ * @file    scipp/math/calculus/differentiation/products.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the vector-jacobian and of the jacobian-vector products.
+ * @date    2023-07-29
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief The value type of the components of a vector of variables or of expressions.
+        template <typename E>
+        using component_t = typename decltype(coerce_expr(std::declval<const E&>()))::element_type::value_t;
+
+
+        /// @brief Return the product of a vector u and the jacobian of some dependent variables ys with respect to given variables.
+        /// @param u The vector, with a component for every output.
+        /// @note  The adjoints of all the outputs are seeded at once with the components of u, then a single reverse sweep
+        ///        over the nodes on a path to the variables computes the derivatives of u . ys w.r.t. every variable.
+        template <typename E, size_t M, bool FLAG, typename U, typename... Vars>
+        auto vjp(const geometry::vector<E, M, FLAG>& ys, const geometry::vector<U, M, FLAG>& u, const Wrt<Vars...>& wrt) {
+
+            using Y = component_t<E>;
+
+            constexpr auto N = sizeof...(Vars);
+            std::tuple<op::multiply_t<U, op::divide_t<Y, typename std::decay_t<Vars>::value_t>>...> values;
+
+            std::vector<expr_base*> roots(M);
+            for (size_t i{}; i < M; ++i)
+                roots[i] = coerce_expr(ys.data[i]).get();
+
+            adjoint_buffer adjoints;
+            active_sweep(active_nodes(roots, wrt.nodes()), [&]() { 
+                for (size_t i{}; i < M; ++i)
+                    coerce_expr(ys.data[i])->accumulate(u.data[i]);
+            });
+
+            meta::for_<N>([&](auto j) constexpr {
+                using value_t = std::tuple_element_t<j, decltype(values)>;
+                std::get<j>(values) = adjoint_cast<value_t>(adjoints.value(std::get<j>(wrt.args).expr.get()));
+            });
+
+            if constexpr (N == 1)
+                return std::get<0>(values);
+            else
+                return values;
+
+        }
+
+
+        /// @brief Return the product of the jacobian of some dependent variables ys with respect to given variables and a vector v.
+        /// @param v The components of the vector, each one with the type of the corresponding variable.
+        /// @note  The tangents of the variables are seeded at once with the components of v, then a single forward sweep 
+        ///        computes the derivatives of ys along v, with the same type of ys.
+        template <typename E, size_t M, bool FLAG, typename... Vars>
+        auto jvp(const geometry::vector<E, M, FLAG>& ys, const Wrt<Vars...>& wrt, const std::tuple<typename std::decay_t<Vars>::value_t...>& v) {
+
+            using Y = component_t<E>;
+
+            constexpr auto N = sizeof...(Vars);
+            geometry::vector<Y, M, FLAG> result;
+
+            std::vector<expr_base*> roots(M);
+            for (size_t i{}; i < M; ++i)
+                roots[i] = coerce_expr(ys.data[i]).get();
+
+            tangent_buffer tangents;
+            tangent_sweep(topological_order(roots), [&](expr_base* node) {
+                meta::for_<N>([&](auto j) constexpr {
+                    if (auto x = std::get<j>(wrt.args).expr.get(); node == x)
+                        x->tangent() = erase(std::get<j>(v));
+                });
+            });
+
+            for (size_t i{}; i < M; ++i)
+                result.data[i] = coerce_expr(ys.data[i])->tangent();
+
+            return result;
+
+        }
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
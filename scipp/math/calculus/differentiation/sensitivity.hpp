@@ -0,0 +1,170 @@
+/**
+ * @file    scipp/math/calculus/differentiation/sensitivity.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the adjoint sensitivities of a time evolution,
+ *          reversed with binomial checkpointing in a bounded memory.
+ * @date    2023-07-31
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief Return the number of steps which can be reversed with s snapshots when every step is computed at most t + 1 times.
+        /// @note  It is the binomial coefficient (s + t)! / (s! t!), saturated to the maximum size_t.
+        inline size_t binomial_steps(size_t s, size_t t) noexcept {
+
+            size_t result{1};
+            for (size_t i{1}; i <= s; ++i) {
+                if (result > std::numeric_limits<size_t>::max() / (t + i))
+                    return std::numeric_limits<size_t>::max();
+                result = result * (t + i) / i;
+            }
+
+            return result;
+
+        }
+
+
+        /// @brief The reversal of a time evolution s_k+1 = step(s_k, ps...) by the binomial checkpointing of revolve.
+        /// @note  Only the values of the states are stored: the graph of a step is recorded when the step is taken,
+        ///        and dropped after its values or its adjoints have been read, so that at most one step is recorded at a time.
+        template <typename STEP, typename S, typename... Ps>
+        struct revolve;
+
+        template <typename STEP, typename... Ts, typename... Ps>
+        struct revolve<STEP, std::tuple<Ts...>, Ps...> {
+
+
+            inline static constexpr size_t M = sizeof...(Ts);
+
+            inline static constexpr size_t P = sizeof...(Ps);
+
+            using state_t = std::tuple<Ts...>;
+
+            using variables_t = std::tuple<variable<Ts>...>;
+
+
+            const STEP& step; ///< The function recording a step on the variables of a state.
+
+            std::tuple<const variable<Ps>&...> ps; ///< The parameters of the evolution.
+
+            std::array<double, M> lambda; ///< The adjoint of the state, without units.
+
+            std::array<double, P> mu{}; ///< The adjoints of the parameters accumulated so far, without units.
+
+
+            /// Record a step from the variables of a state.
+            variables_t record(const variables_t& xs) const {
+
+                return std::apply([&](const auto&... p) { return variables_t(step(xs, p...)); }, ps);
+
+            }
+
+            /// Return the state after n steps from a given state.
+            state_t advance(state_t s, size_t n) const {
+
+                for (size_t k{}; k < n; ++k) {
+
+                    const auto ys = this->record(std::apply([](const auto&... x) { return variables_t(x...); }, s));
+                    s = std::apply([](const auto&... y) { return state_t(static_cast<Ts>(y)...); }, ys);
+
+                }
+
+                return s;
+
+            }
+
+            /// Propagate the adjoints back through the step from a given state, by a single reverse sweep.
+            void reverse(const state_t& s) {
+
+                const auto xs = std::apply([](const auto&... x) { return variables_t(x...); }, s);
+                const auto ys = this->record(xs);
+
+                std::vector<expr_base*> roots, leaves;
+                std::apply([&](const auto&... y) { (roots.push_back(y.expr.get()), ...); }, ys);
+                std::apply([&](const auto&... x) { (leaves.push_back(x.expr.get()), ...); }, xs);
+                std::apply([&](const auto&... p) { (leaves.push_back(p.expr.get()), ...); }, ps);
+
+                adjoint_buffer adjoints;
+                active_sweep(active_nodes(roots, leaves), [&]() {
+                    meta::for_<M>([&](auto i) constexpr {
+                        std::get<i>(ys).expr->accumulate(lambda[i]);
+                    });
+                });
+
+                meta::for_<M>([&](auto i) constexpr {
+                    lambda[i] = adjoint_cast<double>(adjoints.value(std::get<i>(xs).expr.get()));
+                });
+
+                meta::for_<P>([&](auto j) constexpr {
+                    mu[j] += adjoint_cast<double>(adjoints.value(std::get<j>(ps).expr.get()));
+                });
+
+            }
+
+            /// Reverse n steps from a given state, with c free snapshots.
+            /// @note  The first snapshot is taken after the largest number of steps which leaves the others reversible
+            ///        with the same number of recomputations, then the two parts are reversed recursively, the last one first.
+            void run(const state_t& s, size_t n, size_t c) {
+
+                if (n == 0)
+                    return;
+
+                if (n == 1)
+                    return this->reverse(s);
+
+                if (c == 0) {
+                    for (size_t k = n; k-- > 0; )
+                        this->reverse(this->advance(s, k));
+                    return;
+                }
+
+                size_t t{1};
+                while (binomial_steps(c, t) < n)
+                    ++t;
+
+                const size_t m = std::min(binomial_steps(c, t - 1), n - 1);
+
+                {
+                    const state_t snapshot = this->advance(s, m);
+                    this->run(snapshot, n - m, c - 1);
+                }
+
+                this->run(s, m, c);
+
+            }
+
+
+        }; /// struct revolve
+
+
+        /// @brief Return the adjoint sensitivities of a time evolution s_k+1 = step(s_k, ps...) of n steps from a state s0.
+        /// @param step The function recording a step, taking the tuple of the variables of a state and the parameters,
+        ///             and returning the tuple of the variables of the next state.
+        /// @param lambda The derivatives of a scalar function L w.r.t. the components of the final state, without units.
+        /// @param snapshots The number of states which can be stored at once, besides s0.
+        /// @note  Returns the derivatives of L w.r.t. the components of s0 and w.r.t. the parameters, without units.
+        ///        The steps are reversed by one sweep each, backward in time, and recomputed from the snapshots:
+        ///        the memory is bounded by the snapshots, while the number of recomputations of a step grows
+        ///        as the smallest t such that binomial_steps(snapshots, t) >= n.
+        template <typename STEP, typename... Ts, typename... Ps>
+        auto adjoint_evolve(const STEP& step, const std::tuple<Ts...>& s0, size_t n,
+                            const std::array<double, sizeof...(Ts)>& lambda, size_t snapshots, const variable<Ps>&... ps) {
+
+            revolve<STEP, std::tuple<Ts...>, Ps...> reversal{step, {ps...}, lambda};
+            reversal.run(s0, n, snapshots);
+
+            return std::make_tuple(reversal.lambda, reversal.mu);
+
+        }
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
@@ -0,0 +1,230 @@
+/**
+ * @file    scipp/math/calculus/differentiation/sparse.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the sparse jacobians and hessians, 
+ *          computed by seeding the columns or the rows of the same color at once.
+ * @date    2023-08-02
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief Return the pattern of the jacobian of some root nodes w.r.t. some leaves, in the order of the nodes of a sweep.
+        /// @param order The nodes of the sweep, each one listed after all its children, as returned by active_nodes.
+        /// @note  The sorted indices of the leaves every node depends on are merged from its children to its parents:
+        ///        the set of a root is its row of the pattern. A leaf listed more than once takes the first index.
+        inline geometry::sparsity_pattern jacobian_pattern(const std::vector<expr_base*>& order, 
+                                                           const std::vector<expr_base*>& roots, 
+                                                           const std::vector<expr_base*>& leaves) {
+
+            std::unordered_map<const expr_base*, size_t> position;
+            position.reserve(leaves.size());
+            for (size_t j{}; j < leaves.size(); ++j)
+                position.emplace(leaves[j], j);
+
+            std::unordered_map<const expr_base*, std::vector<size_t>> depends;
+            depends.reserve(order.size());
+
+            std::vector<expr_base*> children;
+            std::vector<size_t> merged;
+            for (auto node : order) {
+
+                auto& set = depends[node];
+                if (position.contains(node)) {
+                    set.assign(1, position.at(node));
+                    continue;
+                }
+
+                children.clear();
+                node->children(children);
+
+                for (auto child : children) {
+
+                    if (!depends.contains(child) || child == node) 
+                        continue;
+
+                    const auto& other = depends.at(child);
+                    merged.clear();
+                    std::ranges::set_union(set, other, std::back_inserter(merged));
+                    set.swap(merged);
+
+                }
+
+            }
+
+            geometry::sparsity_pattern pattern;
+            pattern.columns = leaves.size();
+            for (auto root : roots)
+                pattern.push_row(depends.contains(root) ? std::span<const size_t>(depends.at(root)) : std::span<const size_t>());
+
+            return pattern;
+
+        }
+
+
+        /// @brief Return the pattern of the jacobian of some dependent variables y w.r.t. some variables x.
+        template <typename V1, size_t M, typename V2, size_t N>
+            requires (is_variable_v<std::remove_const_t<V1>> && is_variable_v<std::remove_const_t<V2>>)
+        geometry::sparsity_pattern jacobian_pattern(std::span<V1, M> y, std::span<V2, N> x) {
+
+            std::vector<expr_base*> roots(y.size()), leaves(x.size());
+            std::ranges::transform(y, roots.begin(), [](const auto& v) -> expr_base* { return v.expr.get(); });
+            std::ranges::transform(x, leaves.begin(), [](const auto& v) -> expr_base* { return v.expr.get(); });
+
+            return jacobian_pattern(active_nodes(roots, leaves), roots, leaves);
+
+        }
+
+
+        /// @brief Return the jacobian of some dependent variables y w.r.t. some variables x, as a sparse matrix.
+        /// @note  The pattern is read from the graph, then the columns are colored so that no row depends on two columns
+        ///        of the same color, and so are the rows. If the columns need less colors, all the x of a color are seeded 
+        ///        by a single forward sweep, otherwise all the y of a color by a single reverse sweep: every nonzero is read 
+        ///        from the only seed of its color it depends on, so the cost is proportional to the number of colors 
+        ///        (3 or 4 for the forces of a ring of particles) instead of the number of variables.
+        template <typename V1, size_t M, typename V2, size_t N>
+            requires (is_variable_v<std::remove_const_t<V1>> && is_variable_v<std::remove_const_t<V2>>)
+        auto sparse_jacobian(std::span<V1, M> y, std::span<V2, N> x) {
+
+            using x_t = typename std::remove_const_t<V2>::value_t;
+            using value_t = op::divide_t<typename std::remove_const_t<V1>::value_t, x_t>;
+
+            std::vector<expr_base*> roots(y.size()), leaves(x.size());
+            std::ranges::transform(y, roots.begin(), [](const auto& v) -> expr_base* { return v.expr.get(); });
+            std::ranges::transform(x, leaves.begin(), [](const auto& v) -> expr_base* { return v.expr.get(); });
+
+            const auto active = active_nodes(roots, leaves);
+            geometry::sparse_matrix<value_t> result(jacobian_pattern(active, roots, leaves));
+
+            const auto transposed = result.transpose();
+            std::vector<size_t> column_colors, row_colors;
+            const size_t column_count = geometry::color_columns(result, column_colors);
+            const size_t row_count = geometry::color_columns(transposed, row_colors);
+
+            if (column_count <= row_count) {
+
+                const auto order = topological_order(roots);
+                tangent_buffer tangents;
+
+                std::unordered_map<const expr_base*, size_t> position;
+                for (size_t j{}; j < x.size(); ++j)
+                    position.emplace(leaves[j], j);
+
+                for (size_t c{}; c < column_count; ++c) {
+
+                    tangent_sweep(order, [&](expr_base* node) {
+                        if (position.contains(node) && column_colors[position.at(node)] == c)
+                            x[position.at(node)].expr->tangent() = erase(x_t{1.0});
+                    });
+
+                    for (size_t i{}; i < y.size(); ++i)
+                        for (size_t k = result.offsets[i]; k < result.offsets[i + 1]; ++k)
+                            if (column_colors[result.indices[k]] == c)
+                                result.values[k] = adjoint_cast<value_t>(y[i].expr->tangent());
+
+                }
+
+            } else {
+
+                adjoint_buffer adjoints;
+                for (size_t c{}; c < row_count; ++c) {
+
+                    active_sweep(active, [&]() {
+                        for (size_t i{}; i < y.size(); ++i)
+                            if (row_colors[i] == c)
+                                y[i].expr->accumulate(1.0);
+                    });
+
+                    for (size_t j{}; j < x.size(); ++j)
+                        for (size_t k = transposed.offsets[j]; k < transposed.offsets[j + 1]; ++k)
+                            if (const size_t i = transposed.indices[k]; row_colors[i] == c)
+                                result.values[result.find(i, j)] = adjoint_cast<value_t>(adjoints.value(x[j].expr.get()));
+
+                }
+
+            }
+
+            return result;
+
+        }
+
+
+        /// @brief Return the hessian of a dependent variable y w.r.t. some variables x of the same type, as a sparse matrix.
+        /// @note  The gradient of y is built as an expression by a single reverse sweep, and the pattern of its jacobian is read
+        ///        from its graph. The columns are colored so that no component of the gradient depends on two columns of the same 
+        ///        color, then all the x of a color are seeded by a single forward sweep over the gradient (forward over reverse).
+        ///        The symmetry is not exploited, so the number of sweeps is the one of the coloring of a jacobian.
+        template <typename T, typename V, size_t N>
+            requires is_variable_v<std::remove_const_t<V>>
+        auto sparse_hessian(const variable<T>& y, std::span<V, N> x) {
+
+            using x_t = typename std::remove_const_t<V>::value_t;
+            using value_t = op::divide_t<op::divide_t<T, x_t>, x_t>;
+
+            std::vector<expr_ptr<x_t>> exprs(x.size());
+            std::vector<expr_base*> leaves(x.size());
+            std::vector<void*> slots(x.size());
+            std::ranges::transform(x, leaves.begin(), [](const auto& v) -> expr_base* { return v.expr.get(); });
+            std::ranges::transform(exprs, slots.begin(), [](auto& e) -> void* { return &e; });
+
+            collecting_sweepx(y.expr.get(), leaves, slots, [&]() { y.expr->accumulatex(constant<T>(T{1.0})); });
+
+            // a missing expression is a component of the gradient which does not depend on the variables
+            std::vector<expr_base*> roots;
+            std::vector<size_t> components;
+            for (size_t i{}; i < x.size(); ++i)
+                if (exprs[i]) {
+                    roots.push_back(exprs[i].get());
+                    components.push_back(i);
+                }
+
+            const auto order = topological_order(roots);
+            tangent_buffer tangents;
+            const auto pattern = jacobian_pattern(active_nodes(roots, leaves), roots, leaves);
+
+            geometry::sparsity_pattern full;
+            full.columns = x.size();
+            for (size_t i{}, r{}; i < x.size(); ++i)
+                if (r < components.size() && components[r] == i) {
+                    full.push_row(std::span(pattern.indices).subspan(pattern.offsets[r], pattern.offsets[r + 1] - pattern.offsets[r]));
+                    ++r;
+                } else 
+                    full.push_row({});
+
+            geometry::sparse_matrix<value_t> result(full);
+
+            std::vector<size_t> colors;
+            const size_t count = geometry::color_columns(full, colors);
+
+            std::unordered_map<const expr_base*, size_t> position;
+            for (size_t j{}; j < x.size(); ++j)
+                position.emplace(leaves[j], j);
+
+            for (size_t c{}; c < count; ++c) {
+
+                tangent_sweep(order, [&](expr_base* node) {
+                    if (position.contains(node) && colors[position.at(node)] == c)
+                        x[position.at(node)].expr->tangent() = erase(x_t{1.0});
+                });
+
+                for (size_t i : components)
+                    for (size_t k = result.offsets[i]; k < result.offsets[i + 1]; ++k)
+                        if (colors[result.indices[k]] == c)
+                            result.values[k] = adjoint_cast<value_t>(exprs[i]->tangent());
+
+            }
+
+            return result;
+
+        }
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
@@ -0,0 +1,339 @@
+/**
+ * @file    math/calculus/differentiation/sweep.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the forward and reverse sweeps over an expression graph.
+ * @date    2023-07-21
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief Return the nodes reachable from some root nodes, each one listed once after all its children.
+        /// @note  The graph is visited with an explicit stack, so that deep expressions do not overflow the call stack.
+        ///        The visited nodes are stored in the memory resource selected on the tape of the calling thread, if any.
+        inline std::vector<expr_base*> topological_order(const std::vector<expr_base*>& roots) {
+
+            std::vector<expr_base*> order;
+            std::pmr::unordered_set<const expr_base*> visited(selected_resource());
+            std::vector<std::pair<expr_base*, bool>> stack;
+            std::vector<expr_base*> children;
+
+            for (auto root = roots.rbegin(); root != roots.rend(); ++root)
+                stack.emplace_back(*root, false);
+
+            while (!stack.empty()) {
+
+                auto& [node, expanded] = stack.back();
+
+                if (expanded) {
+
+                    order.push_back(node);
+                    stack.pop_back();
+
+                } else if (!visited.insert(node).second)
+                    stack.pop_back();
+
+                else {
+
+                    expanded = true;
+
+                    children.clear();
+                    node->children(children);
+
+                    for (auto child : children)
+                        if (!visited.contains(child))
+                            stack.emplace_back(child, false);
+
+                }
+
+            }
+
+            return order;
+
+        }
+
+        /// @brief Return the nodes reachable from a root node, each one listed once after all its children.
+        inline std::vector<expr_base*> topological_order(expr_base* root) {
+
+            return topological_order(std::vector<expr_base*>{root});
+
+        }
+
+
+        /// @brief Return the nodes reachable from some root nodes and lying on a path to some leaves, 
+        ///        each one listed once after all its children.
+        /// @note  A node is active if it is one of the leaves or if one of its children is active: 
+        ///        the adjoints of the other nodes can not reach the leaves, so a reverse sweep can skip them.
+        ///        The activity is computed along the visit of the graph, as the nodes are sorted.
+        inline std::vector<expr_base*> active_nodes(const std::vector<expr_base*>& roots, const std::vector<expr_base*>& leaves) {
+
+            std::vector<expr_base*> order;
+            std::pmr::unordered_map<const expr_base*, bool> active(selected_resource()); ///< The visited nodes and whether they are active.
+            std::vector<const expr_base*> targets(leaves.begin(), leaves.end()); ///< The leaves, sorted for searching them.
+            std::ranges::sort(targets);
+            std::vector<std::pair<expr_base*, bool>> stack;
+            std::vector<expr_base*> children;
+
+            for (auto root = roots.rbegin(); root != roots.rend(); ++root)
+                stack.emplace_back(*root, false);
+
+            while (!stack.empty()) {
+
+                auto& [node, expanded] = stack.back();
+
+                if (expanded) {
+
+                    children.clear();
+                    node->children(children);
+
+                    const bool reaches = std::ranges::binary_search(targets, node) || 
+                        std::ranges::any_of(children, [&](auto child) { return active.at(child); });
+
+                    if (reaches) {
+                        active.at(node) = true;
+                        order.push_back(node);
+                    }
+
+                    stack.pop_back();
+
+                } else if (!active.try_emplace(node, false).second)
+                    stack.pop_back();
+
+                else {
+
+                    expanded = true;
+
+                    children.clear();
+                    node->children(children);
+
+                    for (auto child : children)
+                        if (!active.contains(child))
+                            stack.emplace_back(child, false);
+
+                }
+
+            }
+
+            return order;
+
+        }
+
+        /// @brief Return the nodes reachable from a root node and lying on a path to some leaves, 
+        ///        each one listed once after all its children.
+        inline std::vector<expr_base*> active_nodes(expr_base* root, const std::vector<expr_base*>& leaves) {
+
+            return active_nodes(std::vector<expr_base*>{root}, leaves);
+
+        }
+
+
+        /// @brief Recompute the values of the nodes a root node depends on, after some of its leaves have changed.
+        /// @note  Only the nodes depending on a leaf changed since their last evaluation are recomputed, each one once.
+        inline void forward_sweep(expr_base* root) {
+
+            for (auto node : topological_order(root)) {
+
+                const auto generation = node->children_generation();
+
+                if (generation > node->generation) {
+
+                    node->update();
+                    node->generation = generation;
+
+                }
+
+            }
+
+        }
+
+
+        /// @brief Propagate the adjoints through some nodes sorted in topological order.
+        /// @param order The nodes of the sweep, each one listed after all its children.
+        /// @param seed The function seeding the adjoints of the root nodes.
+        /// @note  Every node is visited exactly once, after the adjoints of all its parents have been accumulated.
+        ///        The adjoints are accumulated in the adjoint buffer active on the calling thread, which is cleared first,
+        ///        while the nodes are only read: a graph can be swept by many threads at once.
+        template <typename F>
+        void reverse_sweep(const std::vector<expr_base*>& order, F&& seed) {
+
+            auto& adjoints = adjoint_buffer::current();
+            adjoints.clear();
+            adjoints.reserve(order.size());
+
+            std::invoke(std::forward<F>(seed));
+
+            for (auto node = order.rbegin(); node != order.rend(); ++node)
+                (*node)->backward();
+
+        }
+
+        /// @brief Propagate the adjoints through the active nodes of a sweep, sorted in topological order.
+        /// @param active The active nodes of the sweep, as returned by active_nodes.
+        /// @param seed The function seeding the adjoints of the root nodes.
+        /// @note  Only the active nodes are given an adjoint and visited: the contributions to the other nodes are dropped.
+        template <typename F>
+        void active_sweep(const std::vector<expr_base*>& active, F&& seed) {
+
+            auto& adjoints = adjoint_buffer::current();
+            adjoints.clear();
+            adjoints.activate(active);
+
+            std::invoke(std::forward<F>(seed));
+
+            for (auto node = active.rbegin(); node != active.rend(); ++node)
+                (*node)->backward();
+
+        }
+
+        /// @brief Propagate many adjoints at once through the active nodes of a sweep, sorted in topological order.
+        /// @param buffers The adjoint buffers of the lanes of the sweep, one for every seed.
+        /// @param seed The function seeding the adjoints of the root nodes of a lane, called with the buffer of the lane active.
+        /// @note  The graph is visited once: every node propagates the adjoints of all the lanes in which it has been reached, 
+        ///        each one in the buffer of its lane. The buffers are cleared first.
+        template <typename F>
+        void batched_sweep(const std::vector<expr_base*>& active, std::span<adjoint_buffer* const> buffers, F&& seed) {
+
+            auto& current = adjoint_buffer::active();
+            const auto previous = current;
+
+            try {
+
+                for (size_t k{}; k < buffers.size(); ++k) {
+
+                    buffers[k]->clear();
+                    buffers[k]->activate(active);
+
+                    current = buffers[k];
+                    seed(k);
+
+                }
+
+                for (auto node = active.rbegin(); node != active.rend(); ++node)
+                    for (auto buffer : buffers)
+                        if (buffer->reached(*node)) {
+                            current = buffer;
+                            (*node)->backward();
+                        }
+
+            } catch (...) {
+
+                current = previous;
+                throw;
+
+            }
+
+            current = previous;
+
+        }
+
+        /// @brief Propagate the adjoints from a root node to all the nodes it depends on.
+        /// @param root The root node of the sweep.
+        /// @param seed The function seeding the adjoint of the root node.
+        template <typename F>
+        void reverse_sweep(expr_base* root, F&& seed) {
+
+            reverse_sweep(topological_order(root), std::forward<F>(seed));
+
+        }
+
+
+        /// @brief Propagate the adjoints from a root node to all the nodes it depends on, as expressions.
+        /// @param root The root node of the sweep.
+        /// @param seed The function seeding the adjoint expression of the root node.
+        /// @note  The adjoint expressions are released at the end of the sweep, since they may refer to their own node:
+        ///        the derivative expressions are collected by the variables bound with bind_expr.
+        template <typename F>
+        void reverse_sweepx(expr_base* root, F&& seed) {
+
+            const auto order = topological_order(root);
+
+            for (auto node : order)
+                node->clear();
+
+            try {
+
+                std::invoke(std::forward<F>(seed));
+
+                for (auto node = order.rbegin(); node != order.rend(); ++node)
+                    (*node)->backwardx();
+
+            } catch (...) {
+
+                for (auto node : order)
+                    node->clear();
+                throw;
+
+            }
+
+            for (auto node : order)
+                node->clear();
+
+        }
+
+        /// @brief Propagate the adjoints from a root node as expressions, collecting the derivative expressions of some leaves.
+        /// @param root The root node of the sweep.
+        /// @param leaves The leaves whose derivative expressions are collected.
+        /// @param slots The expression pointers the derivative expressions are written to, one for every leaf.
+        /// @param seed The function seeding the adjoint expression of the root node.
+        /// @note  The slots are not owned by the leaves, which are unbound when the sweep ends, even if it throws.
+        template <typename F>
+        void collecting_sweepx(expr_base* root, std::span<expr_base* const> leaves, std::span<void* const> slots, F&& seed) {
+
+            auto unbind = [&]() {
+                for (auto leaf : leaves)
+                    leaf->bind_expr(nullptr);
+            };
+
+            try {
+
+                for (size_t i{}; i < leaves.size(); ++i)
+                    leaves[i]->bind_expr(std::shared_ptr<void>(slots[i], [](void*) {}));
+
+                reverse_sweepx(root, std::forward<F>(seed));
+
+            } catch (...) {
+
+                unbind();
+                throw;
+
+            }
+
+            unbind();
+
+        }
+
+
+        /// @brief Propagate the tangents through some nodes sorted in topological order.
+        /// @param order The nodes of the sweep, each one listed after all its children.
+        /// @param seed The function called on every node after its tangent is computed, to seed the tangents of the leaves.
+        /// @note  Every node is visited exactly once, after the tangents of all its children have been computed.
+        ///        The tangents are stored in the tangent buffer active on the calling thread, which is cleared first,
+        ///        while the nodes are only read: a graph can be swept forward by many threads at once.
+        template <typename F>
+        void tangent_sweep(const std::vector<expr_base*>& order, F&& seed) {
+
+            auto& tangents = tangent_buffer::current();
+            tangents.clear();
+            tangents.reserve(order.size());
+
+            for (auto node : order) {
+
+                node->forward();
+                seed(node);
+
+            }
+
+        }
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
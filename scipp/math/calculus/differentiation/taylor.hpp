@@ -0,0 +1,314 @@
+/**
+ * @file    scipp/math/calculus/differentiation/taylor.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the univariate taylor mode,
+ *          propagating truncated polynomials through an expression graph.
+ * @date    2023-07-30
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief The truncated polynomial arithmetic over the normalized taylor coefficients c_k = f^(k)(0) / k! of order N.
+        /// @note  Every operation takes the coefficients of its operands and writes the ones of its result,
+        ///        by the recurrences obtained differentiating f(a(t)) w.r.t. t: the cost of an operation is O(N^2).
+        template <size_t N>
+        struct taylor_arithmetic {
+
+
+            using series_t = std::array<double, N + 1>;
+
+
+            /// Return the coefficients of a constant.
+            static constexpr series_t constant(double value) noexcept {
+
+                series_t c{};
+                c[0] = value;
+                return c;
+
+            }
+
+
+            /// Return the coefficients of a * b.
+            static constexpr series_t mult(const series_t& a, const series_t& b) noexcept {
+
+                series_t c{};
+                for (size_t k{}; k <= N; ++k)
+                    for (size_t j{}; j <= k; ++j)
+                        c[k] += a[j] * b[k - j];
+
+                return c;
+
+            }
+
+            /// Return the coefficients of 1 / a.
+            static constexpr series_t inv(const series_t& a) noexcept {
+
+                series_t c{};
+                c[0] = 1.0 / a[0];
+                for (size_t k{1}; k <= N; ++k) {
+                    for (size_t j{1}; j <= k; ++j)
+                        c[k] -= a[j] * c[k - j];
+                    c[k] /= a[0];
+                }
+
+                return c;
+
+            }
+
+            /// Return the coefficients of a^n, by repeated squaring.
+            static constexpr series_t pow(series_t a, int n) noexcept {
+
+                if (n < 0)
+                    return inv(pow(a, -n));
+
+                series_t c = constant(1.0);
+                for (; n > 0; n >>= 1) {
+                    if (n & 1)
+                        c = mult(c, a);
+                    a = mult(a, a);
+                }
+
+                return c;
+
+            }
+
+            /// Return the coefficients of a^r, for a real exponent r and a(0) != 0.
+            static series_t pow(const series_t& a, double r) noexcept {
+
+                series_t c{};
+                c[0] = std::pow(a[0], r);
+                for (size_t k{1}; k <= N; ++k) {
+                    for (size_t j{1}; j <= k; ++j)
+                        c[k] += (r * j - (k - j)) * a[j] * c[k - j];
+                    c[k] /= k * a[0];
+                }
+
+                return c;
+
+            }
+
+
+            /// Return the coefficients of f(a), given f(a(0)) and the coefficients of g = f'(a).
+            /// @note  Solves k c_k = sum_j j a_j g_k-j, from c' = g a'.
+            static constexpr series_t integrate(const series_t& a, const series_t& g, double f0) noexcept {
+
+                series_t c{};
+                c[0] = f0;
+                for (size_t k{1}; k <= N; ++k) {
+                    for (size_t j{1}; j <= k; ++j)
+                        c[k] += j * a[j] * g[k - j];
+                    c[k] /= k;
+                }
+
+                return c;
+
+            }
+
+            /// Return the coefficients of exp(a).
+            static series_t exp(const series_t& a) noexcept {
+
+                series_t c{};
+                c[0] = std::exp(a[0]);
+                for (size_t k{1}; k <= N; ++k) {
+                    for (size_t j{1}; j <= k; ++j)
+                        c[k] += j * a[j] * c[k - j];
+                    c[k] /= k;
+                }
+
+                return c;
+
+            }
+
+            /// Return the coefficients of log(a).
+            static series_t log(const series_t& a) noexcept {
+
+                return integrate(a, inv(a), std::log(a[0]));
+
+            }
+
+            /// Return the coefficients of sin(a) and cos(a), or of sinh(a) and cosh(a), which are computed together.
+            static std::pair<series_t, series_t> sincos(const series_t& a, bool hyperbolic) noexcept {
+
+                series_t s{}, c{};
+                s[0] = hyperbolic ? std::sinh(a[0]) : std::sin(a[0]);
+                c[0] = hyperbolic ? std::cosh(a[0]) : std::cos(a[0]);
+                for (size_t k{1}; k <= N; ++k) {
+                    for (size_t j{1}; j <= k; ++j) {
+                        s[k] += j * a[j] * c[k - j];
+                        c[k] += j * a[j] * s[k - j];
+                    }
+                    s[k] /= k;
+                    c[k] /= hyperbolic ? k : -static_cast<double>(k);
+                }
+
+                return {s, c};
+
+            }
+
+            /// Return the coefficients of tan(a), or of tanh(a), whose derivative is 1 + tan(a)^2, or 1 - tanh(a)^2.
+            static series_t tan(const series_t& a, bool hyperbolic) noexcept {
+
+                const double sign = hyperbolic ? -1.0 : 1.0;
+
+                series_t c{}, g{};
+                c[0] = hyperbolic ? std::tanh(a[0]) : std::tan(a[0]);
+                g[0] = 1.0 + sign * c[0] * c[0];
+                for (size_t k{1}; k <= N; ++k) {
+                    for (size_t j{1}; j <= k; ++j)
+                        c[k] += j * a[j] * g[k - j];
+                    c[k] /= k;
+                    for (size_t j{}; j <= k; ++j)
+                        g[k] += sign * c[j] * c[k - j];
+                }
+
+                return c;
+
+            }
+
+            /// Return the coefficients of 1 + s a^2.
+            static constexpr series_t one_plus_square(const series_t& a, double s) noexcept {
+
+                auto c = mult(a, a);
+                for (auto& ck : c)
+                    ck *= s;
+                c[0] += 1.0;
+
+                return c;
+
+            }
+
+
+        }; /// struct taylor_arithmetic
+
+
+        /// @brief Return the taylor series of a dependent variable y along the line x_j(t) = x_j + v_j t through given variables.
+        /// @param v The components of the direction, each one with the type of the corresponding variable.
+        /// @note  The truncated taylor polynomials of order N are propagated through the graph by a single forward pass over
+        ///        the nodes depending on the variables, which are visited once in topological order, while the other nodes are constant.
+        ///        The derivatives d^k y / dt^k are returned without units, as the adjoints. Throws a std::invalid_argument
+        ///        if some node of the graph has no scalar instruction, as for compiling the graph.
+        template <size_t N, typename T, typename... Vars>
+        auto taylor(const variable<T>& y, const Wrt<Vars...>& wrt, const std::tuple<typename std::decay_t<Vars>::value_t...>& v) {
+
+            using arithmetic = taylor_arithmetic<N>;
+            using series_t = typename arithmetic::series_t;
+
+            const auto leaves = wrt.nodes();
+            const auto active = active_nodes(y.expr.get(), leaves);
+
+            std::unordered_map<const expr_base*, series_t> series;
+            series.reserve(active.size());
+
+            meta::for_<sizeof...(Vars)>([&](auto j) constexpr {
+                auto x = std::get<j>(wrt.args).expr.get();
+                auto& c = series[x];
+                c = arithmetic::constant(x->instruct().value);
+                c[1] += static_cast<double>(adjoint_cast<erased_t<typename std::decay_t<decltype(*x)>::value_t>>(std::get<j>(v)));
+            });
+
+            auto of = [&](expr_base* node) -> series_t {
+                if (series.contains(node))
+                    return series.at(node);
+                return arithmetic::constant(node->instruct().value);
+            };
+
+            std::vector<expr_base*> children;
+
+            for (auto node : active) {
+
+                // the variables have been seeded
+                if (series.contains(node))
+                    continue;
+
+                const auto i = node->instruct();
+
+                children.clear();
+                node->children(children);
+
+                const series_t a = children.empty() ? arithmetic::constant(i.value) : of(children[0]);
+                series_t c{};
+
+                switch (i.op) {
+                    case opcode::none:
+                        throw std::invalid_argument("Cannot propagate a taylor series through an expression node without a scalar instruction.");
+                    case opcode::input:
+                    case opcode::constant: c = arithmetic::constant(i.value); break;
+                    case opcode::copy: c = a; break;
+                    case opcode::neg: std::ranges::transform(a, c.begin(), std::negate<>{}); break;
+                    case opcode::add:
+                        c = a;
+                        for (size_t k{1}; k < children.size(); ++k)
+                            std::ranges::transform(c, of(children[k]), c.begin(), std::plus<>{});
+                        break;
+                    case opcode::mult:
+                        c = a;
+                        for (size_t k{1}; k < children.size(); ++k)
+                            c = arithmetic::mult(c, of(children[k]));
+                        break;
+                    case opcode::inv: c = arithmetic::inv(a); break;
+                    case opcode::pow: c = arithmetic::pow(a, i.n); break;
+                    case opcode::root: c = arithmetic::pow(a, 1.0 / i.n); break;
+                    case opcode::abs: std::ranges::transform(a, c.begin(), [s = (a[0] > 0.0) - (a[0] < 0.0)](double ak) { return s * ak; }); break;
+                    case opcode::exp: c = arithmetic::exp(a); break;
+                    case opcode::log: c = arithmetic::log(a); break;
+                    case opcode::sin: c = arithmetic::sincos(a, false).first; break;
+                    case opcode::cos: c = arithmetic::sincos(a, false).second; break;
+                    case opcode::tan: c = arithmetic::tan(a, false); break;
+                    case opcode::asin: c = arithmetic::integrate(a, arithmetic::pow(arithmetic::one_plus_square(a, -1.0), -0.5), std::asin(a[0])); break;
+                    case opcode::acos: c = arithmetic::integrate(a, arithmetic::pow(arithmetic::one_plus_square(a, -1.0), -0.5), std::acos(a[0]));
+                                       std::ranges::transform(c | std::views::drop(1), c.begin() + 1, std::negate<>{}); break;
+                    case opcode::atan: c = arithmetic::integrate(a, arithmetic::inv(arithmetic::one_plus_square(a, 1.0)), std::atan(a[0])); break;
+                    case opcode::sinh: c = arithmetic::sincos(a, true).first; break;
+                    case opcode::cosh: c = arithmetic::sincos(a, true).second; break;
+                    case opcode::tanh: c = arithmetic::tan(a, true); break;
+                    case opcode::asinh: c = arithmetic::integrate(a, arithmetic::pow(arithmetic::one_plus_square(a, 1.0), -0.5), std::asinh(a[0])); break;
+                    case opcode::acosh: {
+                        auto u = arithmetic::mult(a, a);
+                        u[0] -= 1.0;
+                        c = arithmetic::integrate(a, arithmetic::pow(u, -0.5), std::acosh(a[0]));
+                        break;
+                    }
+                    case opcode::atanh: c = arithmetic::integrate(a, arithmetic::inv(arithmetic::one_plus_square(a, -1.0)), std::atanh(a[0])); break;
+                    case opcode::erf: {
+                        auto g = arithmetic::exp(arithmetic::one_plus_square(a, -1.0));
+                        std::ranges::transform(g, g.begin(), [](double gk) { return 2.0 / (std::sqrt(std::numbers::pi) * std::numbers::e) * gk; });
+                        c = arithmetic::integrate(a, g, std::erf(a[0]));
+                        break;
+                    }
+                }
+
+                series[node] = c;
+
+            }
+
+            // d^k y / dt^k = k! c_k
+            series_t derivatives = of(y.expr.get());
+            double factorial{1.0};
+            for (size_t k{1}; k <= N; ++k)
+                derivatives[k] *= (factorial *= k);
+
+            return taylor_series<N, double>(derivatives);
+
+        }
+
+        /// @brief Return the taylor series of a dependent variable y w.r.t. a single variable x, in its value.
+        template <size_t N, typename T, typename X>
+        auto taylor(const variable<T>& y, const Wrt<X>& wrt) {
+
+            using x_t = typename std::decay_t<X>::value_t;
+
+            return taylor<N>(y, wrt, std::tuple<x_t>{x_t{1.0}});
+
+        }
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
@@ -23,19 +23,40 @@ namespace scipp::math {
             using binary_expr<T, T1, T2>::binary_expr;
 
 
-            constexpr void propagate(std::shared_ptr<void> wprime) override {
+            constexpr void backward() override {
 
-                l->propagate(wprime);
-                r->propagate(wprime);
+                l->accumulate(this->adjoint());
+                r->accumulate(this->adjoint());
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = op::add(adjoint_cast<erased_t<T>>(l->tangent()), adjoint_cast<erased_t<T>>(r->tangent()));
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                l->accumulatex(wprime);
+                r->accumulatex(wprime);
 
             }
 
 
             constexpr void update() override {
 
-                l->update();
-                r->update();
-                this->val = l->val + r->val;
+                this->val = op::add(l->val, r->val);
+
+            }
+
+
+            constexpr instruction code() const override {
+
+                return {opcode::add};
 
             }
 
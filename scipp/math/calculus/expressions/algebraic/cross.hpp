@@ -0,0 +1,64 @@
+/**
+ * @file    scipp/math/calculus/expressions/algebraic/cross.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the cross product expression of two vectors
+ * @date    2023-08-01
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief The node of the cross product of two three dimensional vectors.
+        template <typename T, typename T1, typename T2>
+        struct cross_expr : binary_expr<T, T1, T2> {
+
+            using binary_expr<T, T1, T2>::l;
+            using binary_expr<T, T1, T2>::r;
+            using binary_expr<T, T1, T2>::binary_expr;
+
+
+            constexpr void backward() override {
+
+                const auto& wprime_v = this->adjoint();
+                l->accumulate(op::cross(erase(r->val), wprime_v)); // (l x r)'l = r x w'
+                r->accumulate(op::cross(wprime_v, erase(l->val))); // (l x r)'r = w' x l
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = op::add(adjoint_cast<erased_t<T>>(op::cross(l->tangent(), erase(r->val))), adjoint_cast<erased_t<T>>(op::cross(erase(l->val), r->tangent())));
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                l->accumulatex(op::cross(erasex(r), wprime));
+                r->accumulatex(op::cross(wprime, erasex(l)));
+
+            }
+
+
+            constexpr void update() override {
+
+                this->val = op::cross(l->val, r->val);
+
+            }
+
+        };
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
@@ -0,0 +1,113 @@
+/**
+ * @file    scipp/math/calculus/expressions/algebraic/determinant.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the determinant expression of a square matrix
+ * @date    2023-08-02
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief The node of the determinant of a square matrix A.
+        /// @note  The LU factorization computing the value is kept for the adjoint rules: 
+        ///        d det = tr(adj(A) dA), so A' = w' adj(A)^T, that is w' det A^-T without factorizing A again.
+        ///        At a singular matrix the cofactors are the determinants of the minors instead, 
+        ///        while the adjoint expressions still need the inverse and throw.
+        template <typename T, typename T1>
+        struct determinant_expr : unary_expr<T, T1> {
+
+            using unary_expr<T, T1>::x;
+            using unary_expr<T, T1>::val;
+
+            geometry::lu_factorization<T1> factors; ///< The factorization of the matrix.
+
+            constexpr determinant_expr(const T& v, const expr_ptr<T1>& e, const geometry::lu_factorization<T1>& lu) noexcept : 
+                unary_expr<T, T1>(v, e), factors(lu) {}
+
+
+            /// Return the cofactors adj(A)^T of the matrix
+            constexpr auto cofactors() const {
+
+                using cofactors_t = decltype(op::mult(val, op::transpose(factors.inverse())));
+                constexpr size_t n = T1::rows;
+
+                if (!factors.singular)
+                    return op::mult(val, op::transpose(factors.inverse()));
+
+                cofactors_t result{};
+                if constexpr (n == 1)
+                    result.data[0].data[0] = 1.0;
+                else {
+
+                    using minor_t = geometry::matrix<geometry::column_vector<typename T1::element_t, n - 1>, n - 1>;
+
+                    for (size_t i{}; i < n; ++i)
+                        for (size_t j{}; j < n; ++j) {
+
+                            minor_t minor;
+                            for (size_t r{}, mr{}; r < n; ++r) {
+                                if (r == i)
+                                    continue;
+                                for (size_t c{}, mc{}; c < n; ++c)
+                                    if (c != j)
+                                        minor.data[mc++].data[mr] = x->val.data[c].data[r];
+                                ++mr;
+                            }
+
+                            const auto d = geometry::lu_factorization<minor_t>(minor).determinant();
+                            result.data[j].data[i] = (i + j) % 2 ? -d : d;
+
+                        }
+
+                }
+
+                return result;
+
+            }
+
+
+            constexpr void backward() override {
+
+                const auto& wprime_v = this->adjoint();
+                x->accumulate(op::mult(wprime_v, erase(this->cofactors())));
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = adjoint_cast<erased_t<T>>(op::dot(erase(this->cofactors()), x->tangent()));
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                const auto u = erasex(x);
+                x->accumulatex(op::mult(op::mult(wprime, op::determinant(u)), op::transpose(op::inverse(u))));
+
+            }
+
+
+            constexpr void update() override {
+
+                factors = geometry::lu_factorization<T1>(x->val);
+                this->val = factors.determinant();
+
+            }
+
+        };
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
@@ -0,0 +1,64 @@
+/**
+ * @file    scipp/math/calculus/expressions/algebraic/dot.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the dot product expression of two vectors or matrices
+ * @date    2023-08-01
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief The node of the dot product of two vectors, or of the frobenius product of two matrices.
+        template <typename T, typename T1, typename T2>
+        struct dot_expr : binary_expr<T, T1, T2> {
+
+            using binary_expr<T, T1, T2>::l;
+            using binary_expr<T, T1, T2>::r;
+            using binary_expr<T, T1, T2>::binary_expr;
+
+
+            constexpr void backward() override {
+
+                const auto& wprime_v = this->adjoint();
+                l->accumulate(op::mult(wprime_v, erase(r->val))); // (l . r)'l = w' * r
+                r->accumulate(op::mult(wprime_v, erase(l->val))); // (l . r)'r = w' * l
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = op::add(adjoint_cast<erased_t<T>>(op::dot(l->tangent(), erase(r->val))), adjoint_cast<erased_t<T>>(op::dot(erase(l->val), r->tangent())));
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                l->accumulatex(op::mult(wprime, erasex(r)));
+                r->accumulatex(op::mult(wprime, erasex(l)));
+
+            }
+
+
+            constexpr void update() override {
+
+                this->val = op::dot(l->val, r->val);
+
+            }
+
+        };
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
@@ -0,0 +1,65 @@
+/**
+ * @file    scipp/math/calculus/expressions/algebraic/inverse.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the inverse expression of a square matrix
+ * @date    2023-08-02
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief The node of the inverse X of a square matrix A.
+        /// @note  The adjoint rules only need X itself: dX = -X dA X, so A'= -X^T w' X^T.
+        template <typename T, typename T1 = T>
+        struct inverse_expr : unary_expr<T, T1> {
+
+            using unary_expr<T, T1>::x;
+            using unary_expr<T, T1>::val;
+            using unary_expr<T, T1>::unary_expr;
+
+
+            constexpr void backward() override {
+
+                const auto& wprime_v = this->adjoint();
+                const auto transposed = op::transpose(erase(val));
+                x->accumulate(op::neg(op::mult(transposed, op::mult(wprime_v, transposed))));
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = adjoint_cast<erased_t<T>>(op::neg(op::mult(erase(val), op::mult(x->tangent(), erase(val)))));
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                const auto transposed = op::transpose(op::inverse(erasex(x)));
+                x->accumulatex(op::neg(op::mult(transposed, op::mult(wprime, transposed))));
+
+            }
+
+
+            constexpr void update() override {
+
+                this->val = geometry::lu_factorization<T1>(x->val).inverse();
+
+            }
+
+        };
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
@@ -22,22 +22,44 @@ namespace scipp::math {
             using unary_expr<op::invert_t<T>, T>::unary_expr;
 
 
-            constexpr void propagate(std::shared_ptr<void> wprime) override {
+            constexpr void backward() override {
                 
-                auto wprime_v = *std::static_pointer_cast<T>(wprime);
-                auto aux = -wprime_v / op::square(x->val);
-                x->propagate(std::make_shared<decltype(aux)>(aux));
+                const auto& wprime_v = this->adjoint();
+                auto aux = -wprime_v / op::square(erase(x->val));
+                x->accumulate(aux);
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = adjoint_cast<erased_t<op::invert_t<T>>>(-x->tangent() / op::square(erase(x->val)));
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                const auto u = erasex(x);
+                x->accumulatex(op::neg(op::div(wprime, op::square(u))));
 
             }
 
 
             constexpr void update() override {
 
-                x->update();
                 this->val = op::inv(x->val);
 
-            }        
-            
+            }
+
+
+            constexpr instruction code() const override {
+
+                return {opcode::inv};
+
+            }
+
         };
 
 
@@ -0,0 +1,70 @@
+/**
+ * @file    scipp/math/calculus/expressions/algebraic/matvec.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the product expression of a matrix and a vector or another matrix
+ * @date    2023-08-01
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief The node of the product of a matrix l and a column vector or a matrix r.
+        template <typename T, typename T1, typename T2>
+        struct matvec_expr : binary_expr<T, T1, T2> {
+
+            using binary_expr<T, T1, T2>::l;
+            using binary_expr<T, T1, T2>::r;
+            using binary_expr<T, T1, T2>::binary_expr;
+
+
+            constexpr void backward() override {
+
+                const auto& wprime_v = this->adjoint();
+                if constexpr (geometry::is_matrix_v<T2>)
+                    l->accumulate(op::mult(wprime_v, op::transpose(erase(r->val)))); // (l r)'l = w' r^T
+                else
+                    l->accumulate(op::outer(wprime_v, erase(r->val)));
+                r->accumulate(op::mult(op::transpose(erase(l->val)), wprime_v)); // (l r)'r = l^T w'
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = op::add(adjoint_cast<erased_t<T>>(op::mult(l->tangent(), erase(r->val))), adjoint_cast<erased_t<T>>(op::mult(erase(l->val), r->tangent())));
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                if constexpr (geometry::is_matrix_v<T2>)
+                    l->accumulatex(op::mult(wprime, op::transpose(erasex(r))));
+                else
+                    l->accumulatex(op::outer(wprime, erasex(r)));
+                r->accumulatex(op::mult(op::transpose(erasex(l)), wprime));
+
+            }
+
+
+            constexpr void update() override {
+
+                this->val = op::mult(l->val, r->val);
+
+            }
+
+        };
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
@@ -23,22 +23,43 @@ namespace scipp::math {
             using binary_expr<T, T1, T2>::binary_expr;
 
 
-            constexpr void propagate(std::shared_ptr<void> wprime) override {
+            constexpr void backward() override {
 
-                auto wprime_v = *std::static_pointer_cast<T>(wprime);
-                auto rval = wprime_v * r->val;
-                auto lval = wprime_v * l->val;
-                l->propagate(std::make_shared<decltype(rval)>(rval)); // (l * r)'l = w' * r
-                r->propagate(std::make_shared<decltype(lval)>(lval)); // (l * r)'r = l * w'
+                const auto& wprime_v = this->adjoint();
+                auto rval = wprime_v * erase(r->val);
+                auto lval = wprime_v * erase(l->val);
+                l->accumulate(rval); // (l * r)'l = w' * r
+                r->accumulate(lval); // (l * r)'r = l * w'
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = adjoint_cast<erased_t<T>>(l->tangent() * erase(r->val)) + adjoint_cast<erased_t<T>>(erase(l->val) * r->tangent());
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                l->accumulatex(op::mult(wprime, erasex(r)));
+                r->accumulatex(op::mult(wprime, erasex(l)));
 
             }
 
 
             constexpr void update() override {
 
-                l->update();
-                r->update();
-                this->val = l->val * r->val;
+                this->val = op::mult(l->val, r->val);
+
+            }
+
+
+            constexpr instruction code() const override {
+
+                return {opcode::mult};
 
             }
 
@@ -23,18 +23,39 @@ namespace scipp::math {
             using unary_expr<T, T>::unary_expr;
 
 
-            constexpr void propagate(std::shared_ptr<void> wprime) override {
+            constexpr void backward() override {
 
-                auto wprime_v = *std::static_pointer_cast<T>(wprime);
-                x->propagate(std::make_shared<T>(-wprime_v));
+                const auto& wprime_v = this->adjoint();
+                x->accumulate(op::neg(wprime_v));
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = op::neg(x->tangent());
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                x->accumulatex(op::neg(wprime));
 
             }
 
 
             constexpr void update() override {
 
-                x->update();
-                this->val = -x->val;
+                this->val = op::neg(x->val);
+
+            }
+
+
+            constexpr instruction code() const override {
+
+                return {opcode::neg};
 
             }
 
@@ -0,0 +1,64 @@
+/**
+ * @file    scipp/math/calculus/expressions/algebraic/outer.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the outer product expression of two vectors
+ * @date    2023-08-01
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief The node of the outer product of two column vectors, the matrix whose j-th column is l * r_j.
+        template <typename T, typename T1, typename T2>
+        struct outer_expr : binary_expr<T, T1, T2> {
+
+            using binary_expr<T, T1, T2>::l;
+            using binary_expr<T, T1, T2>::r;
+            using binary_expr<T, T1, T2>::binary_expr;
+
+
+            constexpr void backward() override {
+
+                const auto& wprime_v = this->adjoint();
+                l->accumulate(op::mult(wprime_v, erase(r->val))); // (l r^T)'l = w' r
+                r->accumulate(op::mult(op::transpose(wprime_v), erase(l->val))); // (l r^T)'r = w'^T l
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = op::add(adjoint_cast<erased_t<T>>(op::outer(l->tangent(), erase(r->val))), adjoint_cast<erased_t<T>>(op::outer(erase(l->val), r->tangent())));
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                l->accumulatex(op::mult(wprime, erasex(r)));
+                r->accumulatex(op::mult(op::transpose(wprime), erasex(l)));
+
+            }
+
+
+            constexpr void update() override {
+
+                this->val = op::outer(l->val, r->val);
+
+            }
+
+        };
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
@@ -15,29 +15,59 @@ namespace scipp::math {
     namespace calculus {
 
 
-        template <size_t N, typename T>
+        template <int N, typename T>
         struct power_expr : unary_expr<op::power_t<N, T>, T> {
 
             using unary_expr<op::power_t<N, T>, T>::x;
             using unary_expr<op::power_t<N, T>, T>::unary_expr;
 
 
-            constexpr void propagate(std::shared_ptr<void> wprime) override {
+            constexpr void backward() override {
 
-                auto wprime_v = *std::static_pointer_cast<T>(wprime);
-                auto aux = N * wprime_v * op::pow<N - 1>(x->val);
-                x->propagate(std::make_shared<decltype(aux)>(aux));
+                const auto& wprime_v = this->adjoint();
+                auto aux = N * wprime_v * op::pow<N - 1>(erase(x->val));
+                x->accumulate(aux);
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = adjoint_cast<erased_t<op::power_t<N, T>>>(N * op::pow<N - 1>(erase(x->val)) * x->tangent());
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+
+                // the powers of the derivative expressions decrease down to x, so that they are finitely many
+                if constexpr (N == 1)
+                    x->accumulatex(wprime);
+
+                else if constexpr (N > 1)
+                    x->accumulatex(op::mult(wprime, op::mult(static_cast<double>(N), op::pow<N - 1>(erasex(x)))));
+
+                else if constexpr (N < 0)
+                    x->accumulatex(op::mult(wprime, op::div(op::mult(static_cast<double>(N), op::pow<N>(erasex(x))), erasex(x))));
 
             }
 
 
             constexpr void update() override {
 
-                x->update();
                 this->val = op::pow<N>(x->val);
 
             }
 
+
+            constexpr instruction code() const override {
+
+                return {opcode::pow, N};
+
+            }
+
         };
 
 
@@ -0,0 +1,103 @@
+/**
+ * @file    scipp/math/calculus/expressions/algebraic/product.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the product expression of any number of factors
+ * @date    2023-07-29
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @note  The factors have a type closed under multiplication, so that the product has their same type.
+        template <typename T>
+        struct product_expr : nary_expr<T> {
+
+            using nary_expr<T>::xs;
+            using nary_expr<T>::nary_expr;
+
+
+            constexpr void backward() override {
+
+                const size_t n = xs.size();
+                const erased_t<T> wprime = this->adjoint();
+
+                // (x_0 * ... * x_n)'x_i = w' * (x_0 * ... * x_i-1) * (x_i+1 * ... * x_n), without dividing by x_i
+                std::vector<erased_t<T>> right(n, erased_t<T>{1});
+                for (size_t i = n - 1; i > 0; --i)
+                    right[i - 1] = right[i] * erase(xs[i]->val);
+
+                erased_t<T> left{1};
+                for (size_t i{}; i < n; ++i) {
+                    xs[i]->accumulate(wprime * left * right[i]);
+                    left *= erase(xs[i]->val);
+                }
+
+            }
+
+
+            constexpr void forward() override {
+
+                erased_t<T> val{1}, tangent{};
+                for (const auto& x : xs) {
+                    tangent = tangent * erase(x->val) + val * x->tangent();
+                    val *= erase(x->val);
+                }
+
+                this->tangent() = tangent;
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const size_t n = xs.size();
+                const auto wprime = erasex(this->adjointx);
+
+                std::vector<expr_ptr<T>> right(n);
+                for (size_t i = n - 1; i > 0; --i)
+                    right[i - 1] = right[i] ? op::mult(xs[i], right[i]) : xs[i];
+
+                expr_ptr<T> left;
+                for (size_t i{}; i < n; ++i) {
+
+                    const auto others = !left ? right[i] : !right[i] ? left : op::mult(left, right[i]);
+                    xs[i]->accumulatex(others ? op::mult(wprime, erasex(others)) : wprime);
+
+                    left = left ? op::mult(left, xs[i]) : xs[i];
+
+                }
+
+            }
+
+
+            constexpr void update() override {
+
+                T val{1};
+                for (const auto& x : xs)
+                    val *= x->val;
+
+                this->val = val;
+
+            }
+
+
+            constexpr instruction code() const override {
+
+                return {opcode::mult};
+
+            }
+
+        };
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
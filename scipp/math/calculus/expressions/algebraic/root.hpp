@@ -22,22 +22,44 @@ namespace scipp::math {
             using unary_expr<op::root_t<N, T>, T>::unary_expr;
 
 
-            constexpr void propagate(std::shared_ptr<void> wprime) override {
+            constexpr void backward() override {
 
-                auto wprime_v = *std::static_pointer_cast<T>(wprime);
-                auto aux = (1.0 / (N * op::root<N - 1>(x->val))) * wprime_v;
-                x->propagate(std::make_shared<decltype(aux)>(aux));
+                const auto& wprime_v = this->adjoint();
+                auto aux = wprime_v * erase(this->val) / (static_cast<double>(N) * erase(x->val));
+                x->accumulate(aux);
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = adjoint_cast<erased_t<op::root_t<N, T>>>(erase(this->val) / (static_cast<double>(N) * erase(x->val)) * x->tangent());
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                const auto u = erasex(x);
+                x->accumulatex(op::div(op::mult(wprime, op::root<N>(u)), op::mult(static_cast<double>(N), u)));
 
             }
 
 
             constexpr void update() override {
 
-                x->update();
                 this->val = op::root<N>(x->val);
 
             }
 
+
+            constexpr instruction code() const override {
+
+                return {opcode::root, N};
+
+            }
+
         };
 
 
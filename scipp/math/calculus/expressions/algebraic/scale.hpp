@@ -0,0 +1,64 @@
+/**
+ * @file    scipp/math/calculus/expressions/algebraic/scale.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the expression scaling a vector or a matrix by a scalar
+ * @date    2023-08-01
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief The node scaling a whole vector or matrix r by a scalar l.
+        template <typename T, typename T1, typename T2>
+        struct scale_expr : binary_expr<T, T1, T2> {
+
+            using binary_expr<T, T1, T2>::l;
+            using binary_expr<T, T1, T2>::r;
+            using binary_expr<T, T1, T2>::binary_expr;
+
+
+            constexpr void backward() override {
+
+                const auto& wprime_v = this->adjoint();
+                l->accumulate(op::dot(wprime_v, erase(r->val))); // (l * r)'l = w' . r
+                r->accumulate(op::mult(erase(l->val), wprime_v)); // (l * r)'r = l * w'
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = op::add(adjoint_cast<erased_t<T>>(op::mult(l->tangent(), erase(r->val))), adjoint_cast<erased_t<T>>(op::mult(erase(l->val), r->tangent())));
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                l->accumulatex(op::dot(wprime, erasex(r)));
+                r->accumulatex(op::mult(erasex(l), wprime));
+
+            }
+
+
+            constexpr void update() override {
+
+                this->val = op::mult(l->val, r->val);
+
+            }
+
+        };
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
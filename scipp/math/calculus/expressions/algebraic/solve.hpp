@@ -0,0 +1,83 @@
+/**
+ * @file    scipp/math/calculus/expressions/algebraic/solve.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the solution expression of a linear system
+ * @date    2023-08-02
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief The node of the solution x of the linear system A x = b, for a vector or a matrix b.
+        /// @note  The LU factorization computing the value is kept for the adjoint rules: 
+        ///        b' = A^-T w' is a transposed solve with the same factors, and A' = -b' x^T.
+        template <typename T, typename T1, typename T2>
+        struct solve_expr : binary_expr<T, T1, T2> {
+
+            using binary_expr<T, T1, T2>::l;
+            using binary_expr<T, T1, T2>::r;
+            using binary_expr<T, T1, T2>::val;
+
+            geometry::lu_factorization<T1> factors; ///< The factorization of the matrix of the system.
+
+            constexpr solve_expr(const T& v, const expr_ptr<T1>& left, const expr_ptr<T2>& right, const geometry::lu_factorization<T1>& lu) noexcept : 
+                binary_expr<T, T1, T2>(v, left, right), factors(lu) {}
+
+
+            constexpr void backward() override {
+
+                const auto& wprime_v = this->adjoint();
+                const auto rhs = factors.solve_transposed(wprime_v);
+                r->accumulate(rhs);
+
+                if constexpr (geometry::is_matrix_v<T2>)
+                    l->accumulate(op::neg(op::mult(rhs, op::transpose(erase(val)))));
+                else
+                    l->accumulate(op::neg(op::outer(rhs, erase(val))));
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = adjoint_cast<erased_t<T>>(factors.solve(op::sub(r->tangent(), op::mult(l->tangent(), erase(val)))));
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                const auto A = erasex(l);
+                const auto rhs = op::solve(op::transpose(A), wprime);
+                r->accumulatex(rhs);
+
+                if constexpr (geometry::is_matrix_v<T2>)
+                    l->accumulatex(op::neg(op::mult(rhs, op::transpose(op::solve(A, erasex(r))))));
+                else
+                    l->accumulatex(op::neg(op::outer(rhs, op::solve(A, erasex(r)))));
+
+            }
+
+
+            constexpr void update() override {
+
+                factors = geometry::lu_factorization<T1>(l->val);
+                this->val = factors.solve(r->val);
+
+            }
+
+        };
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
@@ -0,0 +1,140 @@
+/**
+ * @file    scipp/math/calculus/expressions/algebraic/stack.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the expressions stacking scalar expressions into a vector and extracting them back
+ * @date    2023-08-01
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief The node of the vector whose components are some scalar expressions.
+        /// @note  It is the bridge from the componentwise vectors of expressions to the vector nodes.
+        template <typename T, typename E>
+        struct stack_expr : expr<T> {
+
+            std::array<expr_ptr<E>, T::dim> xs;
+
+            constexpr stack_expr(const T& v, const std::array<expr_ptr<E>, T::dim>& operands) noexcept : expr<T>(v), xs(operands) { this->generation = children_generation(); }
+
+            ~stack_expr() {
+
+                for (auto& x : xs)
+                    dispose(std::move(x));
+
+            }
+
+            constexpr void children(std::vector<expr_base*>& nodes) const override {
+
+                for (const auto& x : xs)
+                    nodes.push_back(x.get());
+
+            }
+
+            constexpr size_t children_generation() const noexcept override {
+
+                size_t generation{};
+                for (const auto& x : xs)
+                    generation = std::max(generation, x->generation);
+
+                return generation;
+
+            }
+
+
+            constexpr void backward() override {
+
+                const auto& wprime_v = this->adjoint();
+                for (size_t i{}; i < T::dim; ++i)
+                    xs[i]->accumulate(wprime_v.data[i]);
+
+            }
+
+
+            constexpr void forward() override {
+
+                for (size_t i{}; i < T::dim; ++i)
+                    this->tangent().data[i] = xs[i]->tangent();
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                for (size_t i{}; i < T::dim; ++i)
+                    xs[i]->accumulatex(op::component(wprime, i));
+
+            }
+
+
+            constexpr void update() override {
+
+                for (size_t i{}; i < T::dim; ++i)
+                    this->val.data[i] = xs[i]->val;
+
+            }
+
+        };
+
+
+        /// @brief The node of a single component of a vector expression.
+        template <typename T, typename T1>
+        struct component_expr : unary_expr<T, T1> {
+
+            using unary_expr<T, T1>::x;
+
+            size_t index;
+
+            constexpr component_expr(const T& v, const expr_ptr<T1>& e, size_t i) noexcept : unary_expr<T, T1>(v, e), index(i) {}
+
+
+            constexpr void backward() override {
+
+                erased_t<T1> wprime_v{};
+                wprime_v.data[index] = adjoint_cast<typename erased_t<T1>::value_t>(this->adjoint());
+                x->accumulate(wprime_v);
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = x->tangent().data[index];
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                using E = typename erased_t<T1>::value_t;
+
+                geometry::vector<expr_ptr<E>, T1::dim, T1::flag> wprime;
+                for (size_t i{}; i < T1::dim; ++i)
+                    wprime.data[i] = (i == index) ? erasex(this->adjointx) : constant<E>(E{});
+
+                x->accumulatex(op::stack(wprime));
+
+            }
+
+
+            constexpr void update() override {
+
+                this->val = x->val.data[index];
+
+            }
+
+        };
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
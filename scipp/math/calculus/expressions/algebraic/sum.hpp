@@ -0,0 +1,77 @@
+/**
+ * @file    scipp/math/calculus/expressions/algebraic/sum.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the sum expression of any number of terms
+ * @date    2023-07-29
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        template <typename T>
+        struct sum_expr : nary_expr<T> {
+
+            using nary_expr<T>::xs;
+            using nary_expr<T>::nary_expr;
+
+
+            constexpr void backward() override {
+
+                const erased_t<T> wprime = this->adjoint();
+                for (const auto& x : xs)
+                    x->accumulate(wprime);
+
+            }
+
+
+            constexpr void forward() override {
+
+                erased_t<T> tangent{};
+                for (const auto& x : xs)
+                    tangent += x->tangent();
+
+                this->tangent() = tangent;
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                for (const auto& x : xs)
+                    x->accumulatex(wprime);
+
+            }
+
+
+            constexpr void update() override {
+
+                T val{};
+                for (const auto& x : xs)
+                    val += x->val;
+
+                this->val = val;
+
+            }
+
+
+            constexpr instruction code() const override {
+
+                return {opcode::add};
+
+            }
+
+        };
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
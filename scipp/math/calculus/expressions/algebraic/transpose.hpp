@@ -0,0 +1,58 @@
+/**
+ * @file    scipp/math/calculus/expressions/algebraic/transpose.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the transpose expression of a matrix
+ * @date    2023-08-01
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        template <typename T, typename T1>
+        struct transpose_expr : unary_expr<T, T1> {
+
+            using unary_expr<T, T1>::x;
+            using unary_expr<T, T1>::unary_expr;
+
+
+            constexpr void backward() override {
+
+                x->accumulate(op::transpose(this->adjoint()));
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = adjoint_cast<erased_t<T>>(op::transpose(x->tangent()));
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                x->accumulatex(op::transpose(erasex(this->adjointx)));
+
+            }
+
+
+            constexpr void update() override {
+
+                this->val = op::transpose(x->val);
+
+            }
+
+        };
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
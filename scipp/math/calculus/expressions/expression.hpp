@@ -15,38 +15,343 @@ namespace scipp::math {
     namespace calculus {
 
 
+        /// @brief Convert an adjoint contribution to the type of the adjoints of the node storing it.
+        /// @note  Adjoints are stored without the units of their node, the dimensional analysis 
+        ///        of the derivatives is restored by derivatives() with respect to the wrt variables.
+        template <typename T, typename U>
+        constexpr T adjoint_cast(const U& u) noexcept {
+
+            if constexpr (std::is_same_v<T, U>)
+                return u;
+
+            else if constexpr (physics::is_measurement_v<U>)
+                return adjoint_cast<T>(u.value);
+
+            else if constexpr (physics::is_measurement_v<T>)
+                return T(static_cast<typename T::value_t>(u));
+
+            else if constexpr (geometry::is_vector_v<T> && geometry::is_vector_v<U>) {
+
+                T result;
+                for (size_t i{}; i < T::dim; ++i)
+                    result.data[i] = adjoint_cast<typename T::value_t>(u.data[i]);
+
+                return result;
+
+            }
+
+            else if constexpr (geometry::is_matrix_v<T> && geometry::is_matrix_v<U>) {
+
+                T result;
+                for (size_t j{}; j < T::columns; ++j)
+                    result.data[j] = adjoint_cast<typename T::value_t>(u.data[j]);
+
+                return result;
+
+            }
+
+            else 
+                return static_cast<T>(u);
+
+        }
+
+
+        struct tape; 
+
+        struct adjoint_buffer;
+
+        template <typename T, typename U>
+        struct adjoint_cast_expr;
+
+
+        /// @brief Convert an adjoint expression to the value type of the node storing it.
+        template <typename T, typename U>
+        constexpr expr_ptr<T> adjoint_castx(const expr_ptr<U>& u) {
+
+            if constexpr (std::is_same_v<T, U>)
+                return u;
+            else 
+                return make_operation<adjoint_cast_expr<T, U>>(adjoint_cast<T>(u->val), u);
+
+        }
+
+
+        /// @brief The type of the adjoint expressions built from an expression of type T.
+        /// @note  The units are dropped, as for the adjoints, so that differentiating the adjoint expressions again 
+        ///        does not instantiate nodes of ever higher dimensions.
+        template <typename T>
+        struct erased {
+
+            using type = T;
+
+        };
+
+        template <typename T>
+            requires physics::is_measurement_v<T>
+        struct erased<T> {
+
+            using type = typename T::value_t;
+
+        };
+
+        template <typename T>
+            requires geometry::is_vector_v<T>
+        struct erased<T> {
+
+            using type = geometry::vector<typename erased<typename T::value_t>::type, T::dim, T::flag>;
+
+        };
+
+        template <typename T>
+            requires geometry::is_matrix_v<T>
+        struct erased<T> {
+
+            using type = geometry::matrix<typename erased<typename T::value_t>::type, T::columns>;
+
+        };
+
+        template <typename T>
+        using erased_t = typename erased<T>::type;
+
+
+        /// @brief Convert an expression to the type of the adjoint expressions built from it.
+        template <typename U>
+        constexpr expr_ptr<erased_t<U>> erasex(const expr_ptr<U>& u) {
+
+            return adjoint_castx<erased_t<U>>(u);
+
+        }
+
+        /// @brief Convert a value to the type of the adjoints, for combining it with them.
+        template <typename U>
+        constexpr erased_t<U> erase(const U& u) noexcept {
+
+            return adjoint_cast<erased_t<U>>(u);
+
+        }
+
+
+        /// @brief Return a new generation, later than all the previous ones.
+        inline size_t next_generation() noexcept {
+
+            static std::atomic<size_t> generation{0};
+            return ++generation;
+
+        }
+
+
+        /// @brief The operations of a compiled expression graph.
+        enum class opcode : uint8_t {
+            none, input, constant, copy, 
+            neg, add, mult, inv, pow, root, abs, 
+            exp, log, sin, cos, tan, asin, acos, atan, 
+            sinh, cosh, tanh, asinh, acosh, atanh, erf
+        };
+
+
+        /// @brief The instruction computing a node of a compiled expression graph from its operands.
+        struct instruction {
+
+            opcode op{opcode::none}; ///< The operation, none if the node cannot be compiled.
+
+            int n{}; ///< The exponent of the power and root operations.
+
+            double value{}; ///< The value of the node without units, when it is compiled.
+
+            size_t l{}, r{}; ///< The slots of the operands.
+
+        }; /// struct instruction
+
+
+        /// @brief The untyped base of any node type in the expression tree.
+        struct expr_base {
+
+
+            std::atomic<tape*> owner{nullptr}; ///< The tape on which this node has been recorded, if it is still attached.
+
+            size_t index{}; ///< The position of this node in its tape.
+
+            size_t generation{}; ///< The generation of the leaves the value of this node has been computed with.
+
+
+            virtual ~expr_base();
+
+
+            /// Append the children of this expression node to a given list.
+            virtual constexpr void children(std::vector<expr_base*>&) const {}
+
+
+            /// Propagate the adjoint of this expression node to its children.
+            virtual constexpr void backward() = 0;
+
+            /// Propagate the adjoint of this expression node to its children, as an expression.
+            virtual constexpr void backwardx() = 0;
+
+            /// Compute the tangent of this expression node from the tangents of its children.
+            virtual constexpr void forward() = 0;
+
+            /// Reset the adjoint expression of this expression node.
+            virtual constexpr void clear() = 0;
+
+            /// Bind an expression pointer for writing the derivative expression during propagation.
+            virtual void bind_expr(std::shared_ptr<void>) {}
+
+            /// Return the latest generation of the children of this expression node.
+            virtual constexpr size_t children_generation() const noexcept { return generation; }
+
+            /// Update the value of this expression from the values of its children
+            virtual constexpr void update() = 0;
+
+            /// Move the adjoint of this expression node accumulated in a buffer into another one, if it has been reached.
+            virtual void gather(adjoint_buffer&, adjoint_buffer&) {}
+
+
+            /// Return the instruction computing this expression node from its children, for compiling the graph.
+            virtual instruction instruct() const { return {}; }
+
+            /// Return whether this expression node is a constant, whose value never changes.
+            virtual bool is_constant() const noexcept { return false; }
+
+
+        }; /// struct expr_base
+
+
+        /// @brief Release the reference of a node to one of its children, without destroying the graph below it recursively.
+        /// @note  The children left without references are destroyed one at a time by the outermost release on the calling thread,
+        ///        so that destroying a graph as deep as a long accumulation does not overflow the stack.
+        ///        Once the worklist of the thread has been destroyed, as for the global graphs destroyed at exit,
+        ///        the children are released recursively.
+        inline void dispose(std::shared_ptr<expr_base>&& child) noexcept {
+
+            thread_local bool finished{false};
+
+            struct worklist {
+
+                std::vector<std::shared_ptr<expr_base>> pending;
+
+                bool disposing{false};
+
+                ~worklist() { finished = true; }
+
+            };
+
+            if (!child || child.use_count() > 1)
+                return;
+
+            if (finished) {
+                child.reset();
+                return;
+            }
+
+            thread_local worklist list;
+
+            list.pending.push_back(std::move(child));
+            if (list.disposing)
+                return;
+
+            list.disposing = true;
+            while (!list.pending.empty()) {
+                auto node = std::move(list.pending.back());
+                list.pending.pop_back();
+                node.reset();
+            }
+            list.disposing = false;
+
+        }
+
+
         /// @brief The abstract type of any node type in the expression tree.
         template <typename T>
-        struct expr {
+        struct expr : expr_base {
+
+
+            using value_t = T;
+
+            using adjoint_t = erased_t<T>; ///< The type of the adjoints and of the tangents, without units.
 
             
             T val{}; ///< The value of this expression node.
 
+            expr_ptr<T> adjointx; ///< The derivative of the root expression node w.r.t. this expression node, as an expression.
+
 
             /// Construct an expr object with given value.
             explicit constexpr expr(const T& v) noexcept : val(v) {}
 
-            virtual constexpr ~expr() {}
 
+            /// Return the derivative of the root expression node w.r.t. this expression node.
+            /// @note  The adjoint is stored without units in the adjoint buffer active on the calling thread.
+            adjoint_t& adjoint();
+
+            /// Return the pointer to the derivative of the root expression node w.r.t. this expression node,
+            /// or nullptr if this expression node is not active in the sweep.
+            adjoint_t* adjoint_ptr();
+
+            void gather(adjoint_buffer& into, adjoint_buffer& from) override;
+
+            /// Return the derivative of this expression node along the seeded direction.
+            /// @note  The tangent is stored without units in the tangent buffer active on the calling thread.
+            adjoint_t& tangent();
+
+
+            /// Propagate the derivative expression of this expression node to its children, if it has been reached.
+            constexpr void backwardx() override {
+
+                if (this->adjointx)
+                    this->propagatex();
+
+            }
+
+            /// Update the contribution of this expression in the derivative expressions of its children.
+            virtual constexpr void propagatex() = 0;
+
+
+            /// Return the operation computing this expression node from its children.
+            virtual constexpr instruction code() const { return {}; }
+
+            /// Return the instruction computing this expression node, if its value is a scalar.
+            instruction instruct() const final {
+
+                if constexpr (std::is_arithmetic_v<erased_t<T>>) {
+
+                    auto i = this->code();
+                    i.value = static_cast<double>(adjoint_cast<erased_t<T>>(this->val));
+                    return i;
+
+                } else
+                    return {};
 
-            /// Bind a value pointer for writing the derivative during propagation
-            virtual constexpr void bind_value(std::shared_ptr<void>) {}
+            }
+
+
+            constexpr void clear() override {
+
+                this->adjointx = nullptr;
+
+            }
 
             /// Update the contribution of this expression in the derivative of the root node of the expression tree.
-            /// @param wprime The derivative of the root expression node w.r.t. the child expression of this expression node.
-            virtual constexpr void propagate(std::shared_ptr<void>) = 0;
+            /// @param wprime The derivative of the root expression node w.r.t. this expression node.
+            /// @note  The contribution is only accumulated, it is propagated when the reverse sweep visits this node.
+            ///        It is dropped if this node is not active, since it could not reach the wrt variables.
+            template <typename U>
+            constexpr void accumulate(const U& wprime) {
 
+                if (auto adjoint = this->adjoint_ptr())
+                    *adjoint += adjoint_cast<adjoint_t>(wprime);
 
-            // /// Bind an expression pointer for writing the derivative expression during propagation
-            // virtual constexpr void bind_expr(std::shared_ptr<void>) {}
+            }
 
-            // /// Update the contribution of this expression in the derivative of the root node of the expression tree.
-            // /// @param wprime The derivative of the root expression node w.r.t. the child expression of this expression node (as an expression).
-            // virtual constexpr void propagatex(std::shared_ptr<void>) = 0; 
+            /// Update the contribution of this expression in the derivative of the root node of the expression tree, as an expression.
+            /// @param wprime The derivative of the root expression node w.r.t. this expression node, as an expression.
+            /// @note  The contribution is only accumulated, it is propagated when the reverse sweep visits this node.
+            template <typename U>
+            constexpr void accumulatex(const expr_ptr<U>& wprime) {
 
+                const auto w = adjoint_castx<T>(wprime);
+                this->adjointx = this->adjointx ? op::add(this->adjointx, w) : w;
 
-            /// Update the value of this expression
-            virtual constexpr void update() = 0;
+            }
 
 
         }; /// struct expr
@@ -58,10 +363,18 @@ namespace scipp::math {
 
             using expr<T>::expr;
 
-            constexpr void propagate(std::shared_ptr<void>) override {}
+            constexpr void backward() override {}
+
+            constexpr void propagatex() override {}
+
+            constexpr void forward() override {}
 
             constexpr void update() override {}
 
+            constexpr instruction code() const override { return {opcode::constant}; }
+
+            bool is_constant() const noexcept override { return true; }
+
         };
 
 
@@ -69,22 +382,14 @@ namespace scipp::math {
         template <typename T>
         struct variable_expr : expr<T> {
 
-            std::shared_ptr<void> grad_ptr;
             std::shared_ptr<void> gradx_ptr;
 
 
             constexpr variable_expr(const T& v) noexcept : expr<T>(v) {}
 
+            virtual constexpr void bind_expr(std::shared_ptr<void> gradx) override {
 
-            virtual constexpr void bind_value(std::shared_ptr<void> grad) {   
-
-                grad_ptr = grad;
-
-            }
-
-            virtual constexpr void bind_expr(std::shared_ptr<void> gradx) {
-
-                gradx_ptr = std::static_pointer_cast<expr<T>>(gradx);
+                gradx_ptr = gradx;
 
             }
 
@@ -95,29 +400,36 @@ namespace scipp::math {
         template <typename T>
         struct independent_variable_expr : variable_expr<T> {
 
-            using variable_expr<T>::grad_ptr;
             using variable_expr<T>::gradx_ptr;
 
 
             constexpr independent_variable_expr(const T& v) noexcept : variable_expr<T>(v) {}
 
 
-            virtual constexpr void propagate(std::shared_ptr<void> wprime) {
+            virtual constexpr void backward() override {}
+
+
+            virtual constexpr void propagatex() override {
+
+                if (gradx_ptr.get()) {
 
-                if (grad_ptr.get()) {
+                    auto value = std::static_pointer_cast<expr_ptr<T>>(gradx_ptr);
 
-                    auto derivative = std::static_pointer_cast<T>(wprime);
-                    auto value = std::static_pointer_cast<T>(grad_ptr);
+                    *value = *value ? op::add(*value, this->adjointx) : this->adjointx;
 
-                    *value += *derivative;
-                    
                 }
 
             }
 
 
+            virtual constexpr void forward() override {}
+
+
             virtual constexpr void update() override {}
 
+
+            constexpr instruction code() const override { return {opcode::constant}; }
+
         };
 
 
@@ -125,37 +437,68 @@ namespace scipp::math {
         template <typename T>
         struct dependent_variable_expr : variable_expr<T> {
 
-            using variable_expr<T>::grad_ptr;
             using variable_expr<T>::gradx_ptr;
 
             expr_ptr<T> expr;
 
             constexpr dependent_variable_expr(const expr_ptr<T>& e) noexcept
-                : variable_expr<T>(e->val), expr(e) {}
+                : variable_expr<T>(e->val), expr(e) { this->generation = e->generation; }
 
+            ~dependent_variable_expr() { dispose(std::move(expr)); }
 
-            constexpr void propagate(std::shared_ptr<void> wprime) override {
 
-                if (grad_ptr.get()) {
+            constexpr void children(std::vector<expr_base*>& nodes) const override {
+
+                nodes.push_back(expr.get());
+
+            }
+
+            constexpr size_t children_generation() const noexcept override {
+
+                return expr->generation;
+
+            }
+
 
-                    auto derivative = std::static_pointer_cast<T>(wprime);
-                    auto value = std::static_pointer_cast<T>(grad_ptr);
+            constexpr void backward() override {
 
-                    *value += *derivative;
+                expr->accumulate(this->adjoint());
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                if (gradx_ptr.get()) {
+
+                    auto value = std::static_pointer_cast<expr_ptr<T>>(gradx_ptr);
+
+                    *value = *value ? op::add(*value, this->adjointx) : this->adjointx;
 
                 }
 
-                expr->propagate(wprime);
+                expr->accumulatex(this->adjointx);
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = expr->tangent();
 
             }
 
 
             constexpr void update() override {
 
-                this->expr->update();
                 this->val = this->expr->val;
 
             }
+
+
+            constexpr instruction code() const override { return {opcode::copy}; }
+
+            bool is_constant() const noexcept override { return expr->is_constant(); }
             
         };
 
@@ -165,17 +508,93 @@ namespace scipp::math {
 
             expr_ptr<T1> x;
 
-            constexpr unary_expr(const T& v, const expr_ptr<T1>& e) noexcept : expr<T>(v), x(e) {}
+            constexpr unary_expr(const T& v, const expr_ptr<T1>& e) noexcept : expr<T>(v), x(e) { this->generation = x->generation; }
+
+            ~unary_expr() { dispose(std::move(x)); }
+
+            constexpr void children(std::vector<expr_base*>& nodes) const override {
+
+                nodes.push_back(x.get());
+
+            }
+
+            constexpr size_t children_generation() const noexcept override {
+
+                return x->generation;
+
+            }
 
         };
 
+        /// @brief The node in the expression tree converting an expression to the value type of another node.
+        /// @note  It is used to accumulate the derivatives as expressions, whose units are erased as for adjoint_cast.
+        template <typename T, typename U>
+        struct adjoint_cast_expr : unary_expr<T, U> {
+
+            using unary_expr<T, U>::x;
+            using unary_expr<T, U>::unary_expr;
+
+
+            constexpr void backward() override {
+
+                x->accumulate(this->adjoint());
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                x->accumulatex(this->adjointx);
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = adjoint_cast<erased_t<T>>(x->tangent());
+
+            }
+
+
+            constexpr void update() override {
+
+                this->val = adjoint_cast<T>(x->val);
+
+            }
+
+
+            constexpr instruction code() const override { return {opcode::copy}; }
+
+        };
+
+
         template <typename T, typename T1, typename T2>
         struct binary_expr : expr<T> {
 
             expr_ptr<T1> l; 
             expr_ptr<T2> r;
 
-            constexpr binary_expr(const T& v, const expr_ptr<T1>& left, const expr_ptr<T2>& right) noexcept : expr<T>(v), l(left), r(right) {}
+            constexpr binary_expr(const T& v, const expr_ptr<T1>& left, const expr_ptr<T2>& right) noexcept : expr<T>(v), l(left), r(right) { this->generation = children_generation(); }
+
+            ~binary_expr() {
+
+                dispose(std::move(l));
+                dispose(std::move(r));
+
+            }
+
+            constexpr void children(std::vector<expr_base*>& nodes) const override {
+
+                nodes.push_back(l.get());
+                nodes.push_back(r.get());
+
+            }
+
+            constexpr size_t children_generation() const noexcept override {
+
+                return std::max(l->generation, r->generation);
+
+            }
 
         };
 
@@ -186,7 +605,65 @@ namespace scipp::math {
             expr_ptr<T2> c;
             expr_ptr<T3> r;
 
-            constexpr ternary_expr(const T& x, const expr_ptr<T1>& left, const expr_ptr<T2>& center, const expr_ptr<T3>& right) noexcept : expr<T>(x), l(left), c(center), r(right) {}
+            constexpr ternary_expr(const T& x, const expr_ptr<T1>& left, const expr_ptr<T2>& center, const expr_ptr<T3>& right) noexcept : expr<T>(x), l(left), c(center), r(right) { this->generation = children_generation(); }
+
+            ~ternary_expr() {
+
+                dispose(std::move(l));
+                dispose(std::move(c));
+                dispose(std::move(r));
+
+            }
+
+            constexpr void children(std::vector<expr_base*>& nodes) const override {
+
+                nodes.push_back(l.get());
+                nodes.push_back(c.get());
+                nodes.push_back(r.get());
+
+            }
+
+            constexpr size_t children_generation() const noexcept override {
+
+                return std::max({l->generation, c->generation, r->generation});
+
+            }
+
+        };
+
+
+        /// @brief The base of the nodes applying an associative operation to any number of operands of the same type.
+        /// @note  A long accumulation is a single wide node, instead of a chain as deep as the number of its terms.
+        template <typename T>
+        struct nary_expr : expr<T> {
+
+            std::vector<expr_ptr<T>> xs;
+
+            nary_expr(const T& v, std::vector<expr_ptr<T>> operands) noexcept : expr<T>(v), xs(std::move(operands)) { this->generation = children_generation(); }
+
+            ~nary_expr() {
+
+                for (auto& x : xs)
+                    dispose(std::move(x));
+
+            }
+
+            constexpr void children(std::vector<expr_base*>& nodes) const override {
+
+                for (const auto& x : xs)
+                    nodes.push_back(x.get());
+
+            }
+
+            constexpr size_t children_generation() const noexcept override {
+
+                size_t generation{};
+                for (const auto& x : xs)
+                    generation = std::max(generation, x->generation);
+
+                return generation;
+
+            }
 
         };
 
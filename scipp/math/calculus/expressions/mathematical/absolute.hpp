@@ -23,28 +23,61 @@ namespace scipp::math {
             using unary_expr<T, T>::x;
 
 
-            constexpr void propagate(std::shared_ptr<void> wprime) override {
+            constexpr void backward() override {
 
-                auto wprime_v = *std::static_pointer_cast<T>(wprime);
+                const auto& wprime_v = this->adjoint();
 
                 if (x->val < T{0.0}) 
-                    x->propagate(std::make_shared<decltype(wprime_v)>(-wprime_v));
+                    x->accumulate(-wprime_v);
 
                 else if (x->val > T{0.0}) 
-                    x->propagate(std::make_shared<decltype(wprime_v)>(wprime_v));
+                    x->accumulate(wprime_v);
 
                 else 
-                    x->propagate(std::make_shared<decltype(wprime_v)>(0));
+                    x->accumulate(0);
                     
             }
 
+
+            constexpr void forward() override {
+
+                if (x->val < T{0.0}) 
+                    this->tangent() = -x->tangent();
+
+                else if (x->val > T{0.0}) 
+                    this->tangent() = x->tangent();
+
+                else 
+                    this->tangent() = erased_t<T>{};
+
+            }
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+
+                if (x->val < T{0.0}) 
+                    x->accumulatex(op::neg(wprime));
+
+                else if (x->val > T{0.0}) 
+                    x->accumulatex(wprime);
+
+            }
+
+
             constexpr void update() override {
 
-                x->update();
                 this->val = op::abs(x->val);
             
             }
 
+
+            constexpr instruction code() const override {
+
+                return {opcode::abs};
+
+            }
+
         };
 
 
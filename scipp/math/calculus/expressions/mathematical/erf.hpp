@@ -23,21 +23,43 @@ namespace scipp::math {
             using unary_expr<T, T>::x;
 
 
-            constexpr void propagate(std::shared_ptr<void> wprime) override {
+            constexpr void backward() override {
 
-                auto wprime_v = *std::static_pointer_cast<T>(wprime);
-                auto x_v = 2.0 / std::sqrt(std::numbers::pi) * wprime_v * op::exp(-op::square(x->val));
-                x->propagate(std::make_shared<decltype(x_v)>(x_v));
+                const auto& wprime_v = this->adjoint();
+                auto x_v = 2.0 / std::sqrt(std::numbers::pi) * wprime_v * op::exp(-op::square(erase(x->val)));
+                x->accumulate(x_v);
 
             }
 
+
+            constexpr void forward() override {
+
+                this->tangent() = adjoint_cast<erased_t<T>>(2.0 / std::sqrt(std::numbers::pi) * op::exp(-op::square(erase(x->val))) * x->tangent());
+
+            }
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                const auto u = erasex(x);
+                x->accumulatex(op::mult(wprime, op::mult(2.0 / std::sqrt(std::numbers::pi), op::exp(op::neg(op::square(u))))));
+
+            }
+
+
             constexpr void update() override {
 
-                x->update();
                 this->val = op::erf(x->val);
             
             }
 
+
+            constexpr instruction code() const override {
+
+                return {opcode::erf};
+
+            }
+
         };
 
 
@@ -23,22 +23,44 @@ namespace scipp::math {
             using unary_expr<T, T>::x;
 
 
-            constexpr void propagate(std::shared_ptr<void> wprime) override {
+            constexpr void backward() override {
 
-                auto wprime_v = *std::static_pointer_cast<T>(wprime);
-                auto xval = wprime_v / val;
-                x->propagate(std::make_shared<decltype(xval)>(xval));
+                const auto& wprime_v = this->adjoint();
+                auto xval = wprime_v / erase(x->val);
+                x->accumulate(xval);
             
             }
 
 
+            constexpr void forward() override {
+
+                this->tangent() = adjoint_cast<erased_t<T>>(x->tangent() / erase(x->val));
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                const auto u = erasex(x);
+                x->accumulatex(op::div(wprime, u));
+
+            }
+
+
             constexpr void update() override {
 
-                x->update();
                 this->val = op::log(x->val);
             
             }
 
+
+            constexpr instruction code() const override {
+
+                return {opcode::log};
+
+            }
+
         };
 
 
@@ -16,29 +16,65 @@ namespace scipp::math {
     namespace calculus {
 
 
-        template <typename T>
-        struct norm_expr : unary_expr<T, T> {
+        /// @brief The node of the norm of a scalar, or of the euclidean norm of a whole vector.
+        template <typename T, typename T1 = T>
+        struct norm_expr : unary_expr<T, T1> {
 
-            using unary_expr<T, T>::unary_expr;
-            using unary_expr<T, T>::val;
-            using unary_expr<T, T>::x;
+            using unary_expr<T, T1>::unary_expr;
+            using unary_expr<T, T1>::val;
+            using unary_expr<T, T1>::x;
 
 
-            constexpr void propagate(std::shared_ptr<void> wprime) override {
+            constexpr void backward() override {
 
-                auto wprime_v = *std::static_pointer_cast<T>(wprime);
-                auto x_val = wprime_v / x->val;
-                x->propagate(std::make_shared<decltype(x_val)>(x_val));
+                const auto& wprime_v = this->adjoint();
+
+                if constexpr (geometry::is_vector_v<T1>)
+                    x->accumulate(op::mult(op::div(wprime_v, erase(val)), erase(x->val))); // |x|'x = x / |x|
+
+                else {
+                    auto x_val = wprime_v * erase(val) / erase(x->val);
+                    x->accumulate(x_val);
+                }
                                     
             }
 
+
+            constexpr void forward() override {
+
+                if constexpr (geometry::is_vector_v<T1>)
+                    this->tangent() = adjoint_cast<erased_t<T>>(op::div(op::dot(erase(x->val), x->tangent()), erase(val)));
+                else 
+                    this->tangent() = adjoint_cast<erased_t<T>>(erase(val) / erase(x->val) * x->tangent());
+
+            }
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                const auto u = erasex(x);
+
+                if constexpr (geometry::is_vector_v<T1>)
+                    x->accumulatex(op::mult(op::div(wprime, op::norm(u)), u));
+                else 
+                    x->accumulatex(op::mult(wprime, op::div(op::norm(u), u)));
+
+            }
+
+
             constexpr void update() override {
 
-                x->update();
                 this->val = op::norm(x->val);
             
             }
 
+
+            constexpr instruction code() const override {
+
+                return {opcode::abs};
+
+            }
+
         };
 
 
@@ -23,22 +23,44 @@ namespace scipp::math {
             constexpr tangent_expr(const T& v, const expr_ptr<T>& e) noexcept : unary_expr<T, T>(v, e) {}
 
 
-            constexpr void propagate(std::shared_ptr<void> wprime) override {
+            constexpr void backward() override {
 
-                auto wprime_v = *std::static_pointer_cast<T>(wprime);
-                auto x_v = wprime_v * op::square(op::sec(x->val)); 
-                x->propagate(std::make_shared<decltype(x_v)>(x_v));
+                const auto& wprime_v = this->adjoint();
+                auto x_v = wprime_v * op::square(op::sec(erase(x->val))); 
+                x->accumulate(x_v);
+
+            }
+
+
+            constexpr void forward() override {
+
+                this->tangent() = adjoint_cast<erased_t<T>>(op::square(op::sec(erase(x->val))) * x->tangent());
+
+            }
+
+
+            constexpr void propagatex() override {
+
+                const auto wprime = erasex(this->adjointx);
+                const auto u = erasex(x);
+                x->accumulatex(op::mult(wprime, op::square(op::sec(u))));
 
             }
 
 
             constexpr void update() override {
 
-                x->update();
                 this->val = op::tan(x->val);
 
             }
-            
+
+
+            constexpr instruction code() const override {
+
+                return {opcode::tan};
+
+            }
+
         };
 
 
@@ -0,0 +1,341 @@
+/**
+ * @file    math/calculus/expressions/static.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the static expression templates.
+ *          A static expression encodes its graph in its type, so that the chain rule over its value and its derivatives
+ *          is unrolled by the compiler and inlined, without heap allocations nor virtual calls.
+ *          The values are still computed at run time, since every static variable draws its identity from a counter.
+ * @date    2023-07-24
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief The base of any static expression node, through the CRTP.
+        /// @note  Every node provides its value_t, its value() and its derivative(x) w.r.t. a static variable x.
+        template <typename DERIVED>
+        struct static_expr {
+
+            /// Return this node as its derived type.
+            constexpr const DERIVED& derived() const noexcept {
+
+                return static_cast<const DERIVED&>(*this);
+
+            }
+
+        };
+
+
+        /// @brief The node in the static expression tree representing a constant.
+        template <typename T>
+        struct static_constant : static_expr<static_constant<T>> {
+
+            using value_t = T;
+
+            T val;
+
+            constexpr static_constant(const T& v) noexcept : val(v) {}
+
+            constexpr value_t value() const noexcept { return val; }
+
+            template <typename X>
+            constexpr op::divide_t<value_t, X> derivative(const static_variable<X>&) const noexcept {
+
+                return {};
+
+            }
+
+        };
+
+
+        /// @brief The type of the static expression of a value or of a static expression.
+        template <typename T>
+        using static_t = std::conditional_t<is_static_expr_v<T>, T, static_constant<T>>;
+
+        /// @brief Return the static expression of a value, or the static expression itself.
+        template <typename T>
+        constexpr decltype(auto) to_static(const T& x) noexcept {
+
+            if constexpr (is_static_expr_v<T>)
+                return (x);
+            else
+                return static_constant<T>(x);
+
+        }
+
+
+        /// @brief Return a new identity for a static variable, different from all the previous ones.
+        inline size_t next_static_id() noexcept {
+
+            static std::atomic<size_t> id{0};
+            return ++id;
+
+        }
+
+
+        /// @brief The static variable type, the leaf w.r.t. which the static expressions are differentiated.
+        /// @note  The nodes store their children by value, so every copy of a variable keeps the identity 
+        ///        of the variable it has been copied from, and the derivatives are taken w.r.t. all of them.
+        ///        The identity is drawn from a counter, so a variable constructed at the address of a destroyed one,
+        ///        as in the body of a loop, is never taken for it.
+        template <typename T>
+        struct static_variable : static_expr<static_variable<T>> {
+
+            using value_t = T;
+
+            T val;
+
+            const size_t id; ///< The identity of this variable, shared by its copies.
+
+            static_variable(const T& v) noexcept : val(v), id(next_static_id()) {}
+
+            constexpr static_variable& operator=(const T& v) noexcept {
+
+                this->val = v;
+                return *this;
+
+            }
+
+            constexpr value_t value() const noexcept { return val; }
+
+            constexpr explicit operator value_t() const noexcept { return val; }
+
+            template <typename X>
+            constexpr op::divide_t<value_t, X> derivative(const static_variable<X>& x) const noexcept {
+
+                if constexpr (std::is_same_v<T, X>)
+                    return (this->id == x.id) ? op::divide_t<value_t, X>{1.0} : op::divide_t<value_t, X>{};
+                else
+                    return {};
+
+            }
+
+        };
+
+
+        template <typename E>
+        struct static_negate_expr : static_expr<static_negate_expr<E>> {
+
+            using value_t = typename E::value_t;
+
+            E x;
+
+            constexpr static_negate_expr(const E& e) noexcept : x(e) {}
+
+            constexpr value_t value() const noexcept { return op::neg(x.value()); }
+
+            template <typename X>
+            constexpr op::divide_t<value_t, X> derivative(const static_variable<X>& v) const noexcept {
+
+                return op::neg(x.derivative(v));
+
+            }
+
+        };
+
+
+        template <typename L, typename R>
+        struct static_add_expr : static_expr<static_add_expr<L, R>> {
+
+            using value_t = op::add_t<typename L::value_t, typename R::value_t>;
+
+            L l;
+            R r;
+
+            constexpr static_add_expr(const L& left, const R& right) noexcept : l(left), r(right) {}
+
+            constexpr value_t value() const noexcept { return op::add(l.value(), r.value()); }
+
+            template <typename X>
+            constexpr op::divide_t<value_t, X> derivative(const static_variable<X>& v) const noexcept {
+
+                return op::add(l.derivative(v), r.derivative(v));
+
+            }
+
+        };
+
+
+        template <typename L, typename R>
+        struct static_multiply_expr : static_expr<static_multiply_expr<L, R>> {
+
+            using value_t = op::multiply_t<typename L::value_t, typename R::value_t>;
+
+            L l;
+            R r;
+
+            constexpr static_multiply_expr(const L& left, const R& right) noexcept : l(left), r(right) {}
+
+            constexpr value_t value() const noexcept { return op::mult(l.value(), r.value()); }
+
+            template <typename X>
+            constexpr op::divide_t<value_t, X> derivative(const static_variable<X>& v) const noexcept {
+
+                return op::add(op::mult(l.derivative(v), r.value()), op::mult(l.value(), r.derivative(v)));
+
+            }
+
+        };
+
+
+        template <typename E>
+        struct static_invert_expr : static_expr<static_invert_expr<E>> {
+
+            using value_t = op::invert_t<typename E::value_t>;
+
+            E x;
+
+            constexpr static_invert_expr(const E& e) noexcept : x(e) {}
+
+            constexpr value_t value() const noexcept { return op::inv(x.value()); }
+
+            template <typename X>
+            constexpr op::divide_t<value_t, X> derivative(const static_variable<X>& v) const noexcept {
+
+                return op::neg(op::div(x.derivative(v), op::square(x.value())));
+
+            }
+
+        };
+
+
+        template <int N, typename E>
+        struct static_power_expr : static_expr<static_power_expr<N, E>> {
+
+            using value_t = op::power_t<N, typename E::value_t>;
+
+            E x;
+
+            constexpr static_power_expr(const E& e) noexcept : x(e) {}
+
+            constexpr value_t value() const noexcept { return op::pow<N>(x.value()); }
+
+            template <typename X>
+            constexpr op::divide_t<value_t, X> derivative(const static_variable<X>& v) const noexcept {
+
+                if constexpr (N == 1)
+                    return x.derivative(v);
+                else
+                    return op::mult(op::mult(static_cast<double>(N), op::pow<N - 1>(x.value())), x.derivative(v));
+
+            }
+
+        };
+
+
+        template <int N, typename E>
+        struct static_root_expr : static_expr<static_root_expr<N, E>> {
+
+            using value_t = op::root_t<N, typename E::value_t>;
+
+            E x;
+
+            constexpr static_root_expr(const E& e) noexcept : x(e) {}
+
+            constexpr value_t value() const { return op::root<N>(x.value()); }
+
+            template <typename X>
+            constexpr op::divide_t<value_t, X> derivative(const static_variable<X>& v) const {
+
+                return op::mult(op::div(this->value(), op::mult(static_cast<double>(N), x.value())), x.derivative(v));
+
+            }
+
+        };
+
+
+        template <typename E>
+        struct static_exponential_expr : static_expr<static_exponential_expr<E>> {
+
+            using value_t = typename E::value_t;
+
+            E x;
+
+            constexpr static_exponential_expr(const E& e) noexcept : x(e) {}
+
+            constexpr value_t value() const noexcept { return op::exp(x.value()); }
+
+            template <typename X>
+            constexpr op::divide_t<value_t, X> derivative(const static_variable<X>& v) const noexcept {
+
+                return op::mult(this->value(), x.derivative(v));
+
+            }
+
+        };
+
+
+        template <typename E>
+        struct static_logarithm_expr : static_expr<static_logarithm_expr<E>> {
+
+            using value_t = typename E::value_t;
+
+            E x;
+
+            constexpr static_logarithm_expr(const E& e) noexcept : x(e) {}
+
+            constexpr value_t value() const { return op::log(x.value()); }
+
+            template <typename X>
+            constexpr op::divide_t<value_t, X> derivative(const static_variable<X>& v) const {
+
+                return op::div(x.derivative(v), x.value());
+
+            }
+
+        };
+
+
+        template <typename E>
+        struct static_sine_expr : static_expr<static_sine_expr<E>> {
+
+            using value_t = typename E::value_t;
+
+            E x;
+
+            constexpr static_sine_expr(const E& e) noexcept : x(e) {}
+
+            constexpr value_t value() const noexcept { return op::sin(x.value()); }
+
+            template <typename X>
+            constexpr op::divide_t<value_t, X> derivative(const static_variable<X>& v) const noexcept {
+
+                return op::mult(op::cos(x.value()), x.derivative(v));
+
+            }
+
+        };
+
+
+        template <typename E>
+        struct static_cosine_expr : static_expr<static_cosine_expr<E>> {
+
+            using value_t = typename E::value_t;
+
+            E x;
+
+            constexpr static_cosine_expr(const E& e) noexcept : x(e) {}
+
+            constexpr value_t value() const noexcept { return op::cos(x.value()); }
+
+            template <typename X>
+            constexpr op::divide_t<value_t, X> derivative(const static_variable<X>& v) const noexcept {
+
+                return op::neg(op::mult(op::sin(x.value()), x.derivative(v)));
+
+            }
+
+        };
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
@@ -0,0 +1,155 @@
+/**
+ * @file    math/calculus/implicit.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the differentiable root finding and fixed point solves,
+ *          whose derivatives are given by the implicit function theorem.
+ * @date    2023-07-31
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief Return the root of f(x, ps...) in a bracket, by the regula falsi with the illinois modification.
+        /// @note  The iterations stop when the bracket is as narrow as the floating point precision allows,
+        ///        or after max_iter steps. Throws a std::invalid_argument if f has the same sign at both the ends.
+        template <size_t max_iter = 200, typename F, typename X, typename... Ps>
+        X find_root(const F& f, const interval<X>& bracket, const Ps&... ps) {
+
+            X a = bracket.start, b = bracket.end;
+            auto fa = f(a, ps...);
+            auto fb = f(b, ps...);
+
+            if (op::sign(fa) == 0)
+                return a;
+
+            if (op::sign(fb) == 0)
+                return b;
+
+            if (op::sign(fa) == op::sign(fb))
+                throw std::invalid_argument("Invalid bracket: f must have opposite signs at its ends.");
+
+            for (size_t k{}; k < max_iter; ++k) {
+
+                const X c = b - fb * (b - a) / (fb - fa);
+                const auto fc = f(c, ps...);
+
+                if (op::sign(fc) == 0)
+                    return c;
+
+                if (op::sign(fc) != op::sign(fb)) {
+                    a = b;
+                    fa = fb;
+                } else
+                    fa = fa / 2.0; // the end kept twice in a row is halved, so that the bracket shrinks from both sides
+
+                b = c;
+                fb = fc;
+
+                if (op::abs(b - a) <= 4.0 * std::numeric_limits<double>::epsilon() * op::abs(b))
+                    break;
+
+            }
+
+            return b;
+
+        }
+
+
+        /// @brief Return the fixed point of g(x, ps...) reached by iterating g from x0.
+        /// @note  Throws a std::runtime_error if the iterations have not converged after max_iter steps.
+        template <size_t max_iter = 1000, typename G, typename X, typename... Ps>
+        X find_fixed_point(const G& g, const X& x0, const Ps&... ps) {
+
+            X x = x0;
+
+            for (size_t k{}; k < max_iter; ++k) {
+
+                const X next = g(x, ps...);
+
+                if (op::abs(next - x) <= 4.0 * std::numeric_limits<double>::epsilon() * op::abs(next))
+                    return next;
+
+                x = next;
+
+            }
+
+            throw std::runtime_error("The fixed point iterations have not converged.");
+
+        }
+
+
+        /// @brief Return the partial derivatives of the solution x of f(x, ps...) = 0 w.r.t. the parameters ps,
+        ///        by the implicit function theorem: dx/dp = - (df/dp) / (df/dx) at the solution.
+        /// @note  f is recorded once at the solution and differentiated by a single reverse sweep,
+        ///        in a buffer of its own, so this can be called while sweeping another graph.
+        template <typename F, typename X, typename... Ps>
+        auto implicit_partials(const F& f, const X& x, const Ps&... ps) {
+
+            using R = std::decay_t<std::invoke_result_t<const F&, const X&, const Ps&...>>;
+
+            variable<X> xv = x;
+            std::tuple<variable<Ps>...> pv{ps...};
+
+            const variable<R> y = std::apply([&](const auto&... p) { return f(xv, p...); }, pv);
+            const auto df = std::apply([&](auto&... p) { return derivatives(y, wrt(xv, p...)); }, pv);
+            const auto fx = std::get<0>(df);
+
+            auto partials = [&]<size_t... I>(std::index_sequence<I...>) {
+                return std::tuple<op::divide_t<X, Ps>...>{adjoint_cast<op::divide_t<X, Ps>>(-std::get<I + 1>(df) / fx)...};
+            }(std::index_sequence_for<Ps...>{});
+
+            if constexpr (sizeof...(Ps) == 1)
+                return std::get<0>(partials);
+            else
+                return partials;
+
+        }
+
+
+        /// @brief Return the root x of f(x, ps...) in a bracket, as a single node depending on the parameters ps.
+        /// @param f The function, which has to accept both values and variables.
+        /// @note  The root is found on the values, without recording the iterations: its derivatives w.r.t. the parameters
+        ///        are given by the implicit function theorem, so their cost does not depend on the number of iterations.
+        ///        The root is found again when the parameters change and the graph is re-evaluated.
+        template <typename F, typename X, typename... Ps>
+        auto solve_root(const F& f, const interval<X>& bracket, const Ps&... ps) {
+
+            primitive root(
+                [f, bracket](const auto&... p) { return find_root(f, bracket, p...); },
+                [f](const auto& x, const auto&... p) { return implicit_partials(f, x, p...); }
+            );
+
+            return root(ps...);
+
+        }
+
+
+        /// @brief Return the fixed point x = g(x, ps...) reached from x0, as a single node depending on the parameters ps.
+        /// @param g The function, which has to accept both values and variables.
+        /// @note  The derivatives are given by the implicit function theorem applied to f(x, ps...) = g(x, ps...) - x.
+        template <typename G, typename X, typename... Ps>
+        auto solve_fixed_point(const G& g, const X& x0, const Ps&... ps) {
+
+            auto f = [g](const auto& x, const auto&... p) { return g(x, p...) - x; };
+
+            primitive fixed_point(
+                [g, x0](const auto&... p) { return find_fixed_point(g, x0, p...); },
+                [f](const auto& x, const auto&... p) { return implicit_partials(f, x, p...); }
+            );
+
+            return fixed_point(ps...);
+
+        }
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
@@ -18,15 +18,20 @@ namespace scipp::math {
         namespace integrals {
 
 
+            /// @brief Return the integral of a function along a curve.
+            /// @note  The velocity at every point is the jacobian-vector product of the parametrization along t, 
+            ///        computed by a single forward sweep over the graph of the point.
             template <size_t N, typename FUNCTION, typename CURVE> 
                 requires is_curve_v<CURVE>
             static constexpr auto curvilinear(const FUNCTION& f, const CURVE& gamma) {
 
-                using DOMAIN = typename CURVE::value_t;
-                op::multiply_t<std::invoke_result_t<FUNCTION, DOMAIN>, DOMAIN> result{}; 
+                using DOMAIN = typename CURVE::interval_t::value_t;
 
-                const auto step = gamma.interval.step(N);
-                variable<DOMAIN> t = gamma.interval.start;
+                const auto step = gamma.domain.step(N);
+                variable<DOMAIN> t = gamma.domain.start;
+
+                using result_t = decltype(f(gamma(t)) * op::norm(gradient(gamma(t), t)) * step); 
+                result_t result{};
 
                 meta::for_<N>([&](auto) constexpr {
 
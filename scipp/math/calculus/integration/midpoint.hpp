@@ -72,6 +72,21 @@ namespace scipp::math {
             }
 
 
+            /// @brief Midpoint rule for the integral of f(x, ps...) depending on some parameters
+            /// @tparam number of steps
+            /// @param function to integrate, accepting the values of the parameters and dual numbers
+            /// @param interval of integration
+            /// @param variables the integral depends on
+            /// @note  The integral is recorded as a single node, whatever the number of steps
+            template <size_t N, typename FUNCTION, typename DOMAIN, typename... Ps>
+                requires (sizeof...(Ps) > 0)
+            static auto midpoint(const FUNCTION& f, const interval<DOMAIN>& I, const variable<Ps>&... ps) {
+
+                return parametric([I](const auto& g) { return midpoint<N>(g, I); }, f, ps...);
+
+            }
+
+
             /// @brief Midpoint rule for numerical integration
             /// @tparam std::ratio representing the relative_error seeked
             /// @param function to integrate
@@ -0,0 +1,63 @@
+/**
+ * @file    scipp/math/calculus/integration/parametric.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the integrals depending on some parameters,
+ *          recorded as a single node of the expression graph.
+ * @date    2023-07-31
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        namespace integrals {
+
+
+            /// @brief Return the integral of f(x, ps...) computed by a quadrature rule, as a single node depending on the parameters ps.
+            /// @param rule The quadrature rule, returning the integral of a function of x only.
+            /// @note  The value is computed on the values of the parameters. The partial derivatives are computed by the same rule
+            ///        at the same nodes, integrating f on dual numbers seeded along the parameters (forward mode): no node is
+            ///        recorded for the samples, so the graph does not grow with the number of nodes of the rule.
+            template <typename RULE, typename FUNCTION, typename... Ps>
+            auto parametric(const RULE& rule, const FUNCTION& f, const variable<Ps>&... ps) {
+
+                primitive integral(
+                    [rule, f](const Ps&... p) {
+                        return rule([&](const auto& x) { return f(x, p...); });
+                    },
+                    [rule, f](const auto&, const Ps&... p) {
+
+                        const auto result = std::apply([&](const auto&... d) {
+                            return rule([&](const auto& x) { return f(x, d...); });
+                        }, make_duals(p...));
+
+                        using T = typename std::decay_t<decltype(result)>::value_t;
+
+                        return [&]<size_t... I>(std::index_sequence<I...>) {
+                            if constexpr (sizeof...(Ps) == 1)
+                                return result.template derivative<Ps...>(0);
+                            else
+                                return std::tuple<op::divide_t<T, Ps>...>{result.template derivative<Ps>(I)...};
+                        }(std::index_sequence_for<Ps...>{});
+
+                    }
+                );
+
+                return integral(ps...);
+
+            }
+
+
+        } // namespace integrals
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
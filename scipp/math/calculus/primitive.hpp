@@ -0,0 +1,168 @@
+/**
+ * @file    math/calculus/primitive.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the user-defined primitive nodes.
+ * @date    2023-07-30
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief The node in the expression tree computing a black box function of its operands,
+        ///        with its partial derivatives given by a user-defined callback.
+        /// @tparam F The function computing the value of the node from the values of the operands.
+        /// @tparam D The function computing the partial derivatives of the node, from its value and the values of the operands.
+        template <typename T, typename F, typename D, typename... Xs>
+        struct primitive_expr : expr<T> {
+
+
+            inline static constexpr size_t N = sizeof...(Xs);
+
+            using partials_t = std::tuple<op::divide_t<T, Xs>...>;
+
+
+            F f; ///< The function computing the value.
+
+            D df; ///< The function computing the partial derivatives, all at once.
+
+            std::tuple<expr_ptr<Xs>...> xs; ///< The operands.
+
+
+            primitive_expr(const T& v, const F& func, const D& dfunc, const expr_ptr<Xs>&... operands) noexcept :
+
+                expr<T>(v), f(func), df(dfunc), xs(operands...) { this->generation = children_generation(); }
+
+            ~primitive_expr() {
+
+                std::apply([](auto&... x) { (dispose(std::move(x)), ...); }, xs);
+
+            }
+
+
+            constexpr void children(std::vector<expr_base*>& nodes) const override {
+
+                std::apply([&](const auto&... x) { (nodes.push_back(x.get()), ...); }, xs);
+
+            }
+
+            constexpr size_t children_generation() const noexcept override {
+
+                return std::apply([](const auto&... x) { return std::max({x->generation...}); }, xs);
+
+            }
+
+
+            /// Return the partial derivatives of this node w.r.t. its operands, at their current values.
+            partials_t partials() const {
+
+                return std::apply([&](const auto&... x) {
+                    if constexpr (N == 1)
+                        return partials_t{df(this->val, x->val...)};
+                    else
+                        return partials_t(df(this->val, x->val...));
+                }, xs);
+
+            }
+
+
+            constexpr void backward() override {
+
+                const erased_t<T> wprime = this->adjoint();
+                const auto p = this->partials();
+
+                meta::for_<N>([&](auto i) constexpr {
+                    std::get<i>(xs)->accumulate(wprime * erase(std::get<i>(p)));
+                });
+
+            }
+
+
+            constexpr void forward() override {
+
+                const auto p = this->partials();
+
+                erased_t<T> tangent{};
+                meta::for_<N>([&](auto i) constexpr {
+                    tangent += adjoint_cast<erased_t<T>>(erase(std::get<i>(p)) * std::get<i>(xs)->tangent());
+                });
+
+                this->tangent() = tangent;
+
+            }
+
+
+            /// @note  The partial derivatives are given as values, not as expressions, so they can not be differentiated again.
+            constexpr void propagatex() override {
+
+                throw std::logic_error("Cannot build the derivative expressions of a primitive node.");
+
+            }
+
+
+            constexpr void update() override {
+
+                this->val = std::apply([&](const auto&... x) { return f(x->val...); }, xs);
+
+            }
+
+
+        }; /// struct primitive_expr
+
+
+        /// @brief A black box function of some variables, recorded as a single node of the expression graph.
+        /// @note  The value is computed by f(xs...), and the partial derivatives w.r.t. all the operands by df(y, xs...),
+        ///        given the value y = f(xs...): their types are checked against the dimensions of the operands and of y.
+        ///        The adjoints are propagated by a fused chain rule through the node, without recording the inside of f.
+        template <typename F, typename D>
+        struct primitive {
+
+
+            F f; ///< The function computing the value.
+
+            D df; ///< The function computing the partial derivatives, all at once.
+
+
+            constexpr primitive(const F& func, const D& dfunc) noexcept : f(func), df(dfunc) {}
+
+
+            /// Return the node applying this primitive to some variables or expressions.
+            template <typename... Args>
+            auto operator()(const Args&... args) const {
+
+                return this->apply(coerce_expr(args)...);
+
+            }
+
+
+            template <typename... Xs>
+            auto apply(const expr_ptr<Xs>&... xs) const {
+
+                using T = std::decay_t<std::invoke_result_t<const F&, const Xs&...>>;
+                using result_t = std::invoke_result_t<const D&, const T&, const Xs&...>;
+
+                if constexpr (sizeof...(Xs) == 1)
+                    static_assert(std::is_convertible_v<result_t, op::divide_t<T, Xs>...>,
+                                  "The derivative of a primitive must have the dimension of its value over the one of its operand.");
+                else
+                    static_assert(std::is_constructible_v<std::tuple<op::divide_t<T, Xs>...>, result_t>,
+                                  "The partial derivatives of a primitive must have the dimensions of its value over the ones of its operands.");
+
+                return expr_ptr<T>(make_expr<primitive_expr<T, F, D, Xs...>>(f(xs->val...), f, df, xs...));
+
+            }
+
+
+        }; /// struct primitive
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
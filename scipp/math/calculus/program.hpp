@@ -0,0 +1,467 @@
+/**
+ * @file    math/calculus/program.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the programs compiled from the expression graphs.
+ *          A program is a flat list of instructions over scalar slots, replayed without allocating
+ *          nor dispatching virtual calls, on a single point or on a batch of points in SIMD lanes.
+ * @date    2023-07-26
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief Return the result of a comparison between two values.
+        constexpr bool holds(comparison cmp, double l, double r) noexcept {
+
+            switch (cmp) {
+                case comparison::greater: return l > r;
+                case comparison::less: return l < r;
+                case comparison::greater_equal: return l >= r;
+                case comparison::less_equal: return l <= r;
+            }
+
+            return false;
+
+        }
+
+
+        /// @brief Compare the values of two variables, or of a variable and a value.
+        /// @note  The comparison is recorded as a branch on the tape of the calling thread, if it is recording.
+        template <typename T1, typename T2>
+        bool compare(const T1& x, const T2& y, comparison cmp) {
+
+            auto node = []<typename U>(const U& u) -> std::shared_ptr<expr_base> {
+                if constexpr (is_variable_v<U>)
+                    return u.expr;
+                else
+                    return make_expr<constant_expr<double>>(static_cast<double>(adjoint_cast<erased_t<U>>(u)));
+            };
+
+            auto value = []<typename U>(const U& u) -> double {
+                if constexpr (is_variable_v<U>)
+                    return static_cast<double>(adjoint_cast<erased_t<typename U::value_t>>(u.expr->val));
+                else
+                    return static_cast<double>(adjoint_cast<erased_t<U>>(u));
+            };
+
+            const bool taken = holds(cmp, value(x), value(y));
+
+            auto& t = tape::local();
+            if (t.recording)
+                t.branches.push_back({node(x), node(y), cmp, taken});
+
+            return taken;
+
+        }
+
+
+        /// @brief The program computing a scalar expression graph and its gradient w.r.t. some of its nodes.
+        /// @note  Every node of the graph is given a slot, holding its value and its adjoint without units,
+        ///        and is computed by the instruction at the same position, after the instructions of its operands.
+        struct program {
+
+
+            /// @brief A branch recorded with the graph, checked after every evaluation.
+            struct guard {
+
+                size_t l, r; ///< The slots of the compared nodes.
+
+                comparison cmp; ///< The comparison.
+
+                bool taken; ///< The result of the comparison when the graph has been recorded.
+
+            }; /// struct guard
+
+
+            /// @brief The values of a slot for the points of a batch computed together.
+            using lanes = std::experimental::native_simd<double>;
+
+
+            std::vector<instruction> code; ///< The instructions, one for every slot.
+
+            std::vector<double> values; ///< The values of the slots.
+
+            std::vector<double> adjoints; ///< The adjoints of the slots.
+
+            std::vector<lanes> lane_values; ///< The values of the slots for a batch of points.
+
+            std::vector<lanes> lane_adjoints; ///< The adjoints of the slots for a batch of points.
+
+            std::vector<size_t> inputs; ///< The slots of the input nodes.
+
+            std::vector<guard> guards; ///< The branches the graph depends on.
+
+            size_t output{}; ///< The slot of the root node.
+
+            bool valid{true}; ///< Whether all the branches have been taken as recorded at the last evaluation.
+
+
+            program() noexcept = default;
+
+            /// Compile the graph of a root node, and of the nodes compared by some branches, with given input nodes.
+            /// @note  The graph is not visited below the input nodes. Throws a std::invalid_argument if a node
+            ///        of the graph has no instruction, or if its value is not a scalar.
+            program(expr_base* root, const std::vector<expr_base*>& leaves, const std::vector<branch>& branches) {
+
+                std::unordered_map<const expr_base*, size_t> slots;
+
+                auto emit = [&](expr_base* node, instruction i) {
+
+                    if (i.op == opcode::none)
+                        throw std::invalid_argument("Cannot compile an expression node without a scalar instruction.");
+
+                    slots[node] = code.size();
+                    code.push_back(i);
+
+                };
+
+                for (auto leaf : leaves) {
+
+                    const auto i = leaf->instruct();
+
+                    if (i.op == opcode::none)
+                        throw std::invalid_argument("Cannot compile an input node without a scalar value.");
+
+                    if (!slots.contains(leaf))
+                        emit(leaf, {opcode::input, 0, i.value});
+
+                    inputs.push_back(slots.at(leaf));
+
+                }
+
+                std::vector<std::pair<expr_base*, bool>> stack;
+                std::vector<expr_base*> children;
+
+                auto visit = [&](expr_base* top) {
+
+                    stack.emplace_back(top, false);
+
+                    while (!stack.empty()) {
+
+                        auto [node, expanded] = stack.back();
+
+                        if (slots.contains(node))
+                            stack.pop_back();
+
+                        else if (expanded) {
+
+                            stack.pop_back();
+
+                            children.clear();
+                            node->children(children);
+
+                            auto i = node->instruct();
+                            i.l = children.size() > 0 ? slots.at(children[0]) : 0;
+                            i.r = children.size() > 1 ? slots.at(children[1]) : 0;
+
+                            // the sums and the products of more operands are unrolled into unnamed partial slots
+                            for (size_t k{2}; k < children.size(); ++k) {
+                                code.push_back(i);
+                                i.l = code.size() - 1;
+                                i.r = slots.at(children[k]);
+                            }
+
+                            emit(node, i);
+
+                        } else {
+
+                            stack.back().second = true;
+
+                            children.clear();
+                            node->children(children);
+
+                            for (auto child : children)
+                                if (!slots.contains(child))
+                                    stack.emplace_back(child, false);
+
+                        }
+
+                    }
+
+                    return slots.at(top);
+
+                };
+
+                output = visit(root);
+
+                for (const auto& b : branches)
+                    guards.push_back({visit(b.l.get()), visit(b.r.get()), b.cmp, b.taken});
+
+                values.resize(code.size());
+                adjoints.resize(code.size());
+
+                for (size_t i{}; i < code.size(); ++i)
+                    values[i] = code[i].value;
+
+            }
+
+
+            /// Compute the values of all the slots from the values of the input slots.
+            void run() noexcept {
+
+                this->forward(values.data());
+
+                valid = true;
+                for (const auto& g : guards)
+                    valid = valid && (holds(g.cmp, values[g.l], values[g.r]) == g.taken);
+
+            }
+
+
+            /// Compute the adjoints of all the slots w.r.t. the output slot, from the values of the last run.
+            void backpropagate() noexcept {
+
+                std::fill(adjoints.begin(), adjoints.end(), 0.0);
+                adjoints[output] = 1.0;
+
+                this->backward(values.data(), adjoints.data());
+
+            }
+
+
+            /// Compute the output, and optionally the gradient, over a batch of points given as a span of values for every input.
+            /// @note  The points are computed lanes::size() at a time, as the lanes of SIMD registers, and the last points
+            ///        are padded with the first one of their block. The guards are checked on every lane.
+            ///        The gradient is computed only if grads is not empty. Throws a std::invalid_argument if there is not 
+            ///        a span for every input, or if a span has not the size of y.
+            void run(std::span<double> y, std::span<const std::span<const double>> xs, std::span<const std::span<double>> grads = {}) {
+
+                constexpr size_t W = lanes::size();
+
+                const size_t n = y.size();
+                const size_t slots = code.size();
+
+                auto check = [&](const auto& spans, const char* what) {
+                    if (spans.size() != inputs.size())
+                        throw std::invalid_argument("Cannot run a program of " + std::to_string(inputs.size()) + 
+                                                    " inputs with " + std::to_string(spans.size()) + " spans of " + what + ".");
+                    for (const auto& s : spans)
+                        if (s.size() != n)
+                            throw std::invalid_argument("Cannot run a program over a batch of " + std::to_string(n) + 
+                                                        " points with a span of " + what + " of size " + std::to_string(s.size()) + ".");
+                };
+
+                check(xs, "values");
+                if (!grads.empty())
+                    check(grads, "derivatives");
+
+                lane_values.resize(slots);
+                if (!grads.empty())
+                    lane_adjoints.resize(slots);
+
+                for (size_t i{}; i < slots; ++i)
+                    lane_values[i] = code[i].value;
+
+                alignas(std::experimental::memory_alignment_v<lanes>) std::array<double, W> tail;
+
+                auto load = [&](std::span<const double> x, size_t first, size_t count) {
+                    if (count == W)
+                        return lanes(x.data() + first, std::experimental::element_aligned);
+                    tail.fill(x[first]);
+                    std::copy_n(x.data() + first, count, tail.begin());
+                    return lanes(tail.data(), std::experimental::vector_aligned);
+                };
+
+                auto store = [&](const lanes& v, std::span<double> out, size_t first, size_t count) {
+                    if (count == W)
+                        return v.copy_to(out.data() + first, std::experimental::element_aligned);
+                    v.copy_to(tail.data(), std::experimental::vector_aligned);
+                    std::copy_n(tail.begin(), count, out.begin() + first);
+                };
+
+                valid = true;
+
+                for (size_t first{}; first < n; first += W) {
+
+                    const size_t count = std::min(W, n - first);
+
+                    for (size_t k{}; k < inputs.size(); ++k)
+                        lane_values[inputs[k]] = load(xs[k], first, count);
+
+                    this->forward(lane_values.data());
+
+                    for (const auto& g : guards)
+                        valid = valid && holds_lanes(g.cmp, lane_values[g.l], lane_values[g.r], g.taken, count);
+
+                    store(lane_values[output], y, first, count);
+
+                    if (grads.empty())
+                        continue;
+
+                    std::fill(lane_adjoints.begin(), lane_adjoints.end(), lanes(0.0));
+                    lane_adjoints[output] = 1.0;
+
+                    this->backward(lane_values.data(), lane_adjoints.data());
+
+                    for (size_t k{}; k < inputs.size(); ++k)
+                        store(lane_adjoints[inputs[k]], grads[k], first, count);
+
+                }
+
+            }
+
+
+            /// Return the sign of a value, or zero.
+            static double sign(double a) noexcept {
+
+                return (a > 0.0) - (a < 0.0);
+
+            }
+
+            /// Return the signs of the lanes of a value, or zero.
+            static lanes sign(const lanes& a) noexcept {
+
+                lanes s(0.0);
+                where(a > 0.0, s) = 1.0;
+                where(a < 0.0, s) = -1.0;
+                return s;
+
+            }
+
+            /// Return the n-th root of a value, real for the odd roots of negative values as op::root.
+            static double root(double a, int n) noexcept {
+
+                if (n == 3)
+                    return std::cbrt(a);
+
+                if (n % 2)
+                    return std::copysign(std::pow(std::abs(a), 1.0 / n), a);
+
+                return std::pow(a, 1.0 / n);
+
+            }
+
+            /// Return the n-th roots of the lanes of a value, real for the odd roots of negative values as op::root.
+            static lanes root(const lanes& a, int n) noexcept {
+
+                if (n == 3)
+                    return cbrt(a);
+
+                if (n % 2)
+                    return copysign(pow(abs(a), lanes(1.0 / n)), a);
+
+                return pow(a, lanes(1.0 / n));
+
+            }
+
+            /// Return whether a comparison between the first count lanes of two values has always the given result.
+            static bool holds_lanes(comparison cmp, const lanes& l, const lanes& r, bool taken, size_t count) noexcept {
+
+                for (size_t k{}; k < count; ++k)
+                    if (holds(cmp, l[k], r[k]) != taken)
+                        return false;
+
+                return true;
+
+            }
+
+
+            /// Compute the values of all the slots, of type V, from the values of the input slots.
+            template <typename V>
+            void forward(V* values) const noexcept {
+
+                using std::pow, std::abs, std::exp, std::log, std::sin, std::cos, std::tan, std::asin, std::acos, std::atan,
+                      std::sinh, std::cosh, std::tanh, std::asinh, std::acosh, std::atanh, std::erf;
+
+                for (size_t i{}; i < code.size(); ++i) {
+
+                    const auto& c = code[i];
+                    const V a = values[c.l];
+                    const V b = values[c.r];
+
+                    switch (c.op) {
+                        case opcode::none:
+                        case opcode::input:
+                        case opcode::constant: break;
+                        case opcode::copy: values[i] = a; break;
+                        case opcode::neg: values[i] = -a; break;
+                        case opcode::add: values[i] = a + b; break;
+                        case opcode::mult: values[i] = a * b; break;
+                        case opcode::inv: values[i] = 1.0 / a; break;
+                        case opcode::pow: values[i] = pow(a, V(c.n)); break;
+                        case opcode::root: values[i] = root(a, c.n); break;
+                        case opcode::abs: values[i] = abs(a); break;
+                        case opcode::exp: values[i] = exp(a); break;
+                        case opcode::log: values[i] = log(a); break;
+                        case opcode::sin: values[i] = sin(a); break;
+                        case opcode::cos: values[i] = cos(a); break;
+                        case opcode::tan: values[i] = tan(a); break;
+                        case opcode::asin: values[i] = asin(a); break;
+                        case opcode::acos: values[i] = acos(a); break;
+                        case opcode::atan: values[i] = atan(a); break;
+                        case opcode::sinh: values[i] = sinh(a); break;
+                        case opcode::cosh: values[i] = cosh(a); break;
+                        case opcode::tanh: values[i] = tanh(a); break;
+                        case opcode::asinh: values[i] = asinh(a); break;
+                        case opcode::acosh: values[i] = acosh(a); break;
+                        case opcode::atanh: values[i] = atanh(a); break;
+                        case opcode::erf: values[i] = erf(a); break;
+                    }
+
+                }
+
+            }
+
+
+            /// Accumulate the adjoints of all the slots, of type V, from the values of the slots and the seeded adjoints.
+            template <typename V>
+            void backward(const V* values, V* adjoints) const noexcept {
+
+                using std::pow, std::exp, std::sin, std::cos, std::sqrt, std::sinh, std::cosh;
+
+                for (size_t i = code.size(); i-- > 0; ) {
+
+                    const auto& c = code[i];
+                    const V w = adjoints[i];
+                    const V a = values[c.l];
+                    const V b = values[c.r];
+                    const V v = values[i];
+
+                    switch (c.op) {
+                        case opcode::none:
+                        case opcode::input:
+                        case opcode::constant: break;
+                        case opcode::copy: adjoints[c.l] += w; break;
+                        case opcode::neg: adjoints[c.l] -= w; break;
+                        case opcode::add: adjoints[c.l] += w; adjoints[c.r] += w; break;
+                        case opcode::mult: adjoints[c.l] += w * b; adjoints[c.r] += w * a; break;
+                        case opcode::inv: adjoints[c.l] -= w / (a * a); break;
+                        case opcode::pow: adjoints[c.l] += w * V(c.n) * pow(a, V(c.n - 1)); break;
+                        case opcode::root: adjoints[c.l] += w * v / (V(c.n) * a); break;
+                        case opcode::abs: adjoints[c.l] += w * sign(a); break;
+                        case opcode::exp: adjoints[c.l] += w * v; break;
+                        case opcode::log: adjoints[c.l] += w / a; break;
+                        case opcode::sin: adjoints[c.l] += w * cos(a); break;
+                        case opcode::cos: adjoints[c.l] -= w * sin(a); break;
+                        case opcode::tan: adjoints[c.l] += w * (1.0 + v * v); break;
+                        case opcode::asin: adjoints[c.l] += w / sqrt(1.0 - a * a); break;
+                        case opcode::acos: adjoints[c.l] -= w / sqrt(1.0 - a * a); break;
+                        case opcode::atan: adjoints[c.l] += w / (1.0 + a * a); break;
+                        case opcode::sinh: adjoints[c.l] += w * cosh(a); break;
+                        case opcode::cosh: adjoints[c.l] += w * sinh(a); break;
+                        case opcode::tanh: adjoints[c.l] += w * (1.0 - v * v); break;
+                        case opcode::asinh: adjoints[c.l] += w / sqrt(a * a + 1.0); break;
+                        case opcode::acosh: adjoints[c.l] += w / sqrt(a * a - 1.0); break;
+                        case opcode::atanh: adjoints[c.l] += w / (1.0 - a * a); break;
+                        case opcode::erf: adjoints[c.l] += w * (2.0 / std::sqrt(std::numbers::pi)) * exp(-a * a); break;
+                    }
+
+                }
+
+            }
+
+
+        }; /// struct program
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
@@ -0,0 +1,559 @@
+/**
+ * @file    math/calculus/tape.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the linear tape used for recording the expression nodes.
+ * @date    2023-07-20
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace calculus {
+
+
+        /// @brief A monotonic memory region made of contiguous chunks.
+        /// @note  The chunks are kept when the arena is released, so that a new recording reuses the same memory.
+        ///        The chunks are freed with the arena, so an arena handing memory to nodes is shared by their allocators.
+        ///        The count of the live blocks is atomic, since a node may be released on a thread other than the recording one.
+        struct arena {
+
+
+            inline static constexpr size_t chunk_size = 1 << 16; ///< The default size of a chunk in bytes.
+
+
+            std::vector<std::pair<std::unique_ptr<std::byte[]>, size_t>> chunks; ///< The chunks and their size.
+
+            size_t current{}; ///< The index of the chunk in use.
+
+            size_t offset{}; ///< The first free byte of the chunk in use.
+
+            std::atomic<size_t> live{}; ///< The number of blocks handed to the allocators and not given back yet.
+
+
+            /// Allocate a block of given size and alignment.
+            void* allocate(size_t bytes, size_t alignment) {
+
+                while (current < chunks.size()) {
+
+                    void* ptr = chunks[current].first.get() + offset;
+                    size_t space = chunks[current].second - offset;
+
+                    if (std::align(alignment, bytes, ptr, space)) {
+
+                        offset = static_cast<std::byte*>(ptr) - chunks[current].first.get() + bytes;
+                        return ptr;
+
+                    }
+
+                    ++current;
+                    offset = 0;
+
+                }
+
+                const size_t size = std::max(chunk_size, bytes + alignment);
+                chunks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(size), size);
+                current = chunks.size() - 1;
+                offset = 0;
+
+                return this->allocate(bytes, alignment);
+
+            }
+
+
+            /// Make all the chunks available again, without returning them to the system.
+            constexpr void release() noexcept {
+
+                current = 0;
+                offset = 0;
+
+            }
+
+
+            /// Return the number of bytes in use.
+            constexpr size_t used() const noexcept {
+
+                size_t bytes = offset;
+                for (size_t i{}; i < current && i < chunks.size(); ++i)
+                    bytes += chunks[i].second;
+
+                return bytes;
+
+            }
+
+
+            /// Return the number of bytes reserved.
+            constexpr size_t capacity() const noexcept {
+
+                size_t bytes{};
+                for (const auto& chunk : chunks)
+                    bytes += chunk.second;
+
+                return bytes;
+
+            }
+
+
+        }; /// struct arena
+
+
+        /// @brief The allocator handing the memory of the arena of a tape to std::allocate_shared.
+        /// @note  The allocator shares the arena, so that the nodes outliving their tape keep its chunks
+        ///        until the last one of them is destroyed.
+        template <typename T>
+        struct arena_allocator {
+
+
+            using value_t = T;
+
+            using value_type = T;
+
+
+            std::shared_ptr<arena> memory; ///< The arena owning the memory.
+
+
+            arena_allocator(std::shared_ptr<arena> memory) noexcept : memory(std::move(memory)) {}
+
+            template <typename U>
+            arena_allocator(const arena_allocator<U>& other) noexcept : memory(other.memory) {}
+
+
+            T* allocate(size_t n) {
+
+                memory->live.fetch_add(1, std::memory_order_relaxed);
+                return static_cast<T*>(memory->allocate(n * sizeof(T), alignof(T)));
+
+            }
+
+            /// The memory is given back to the arena only when it is released.
+            void deallocate(T*, size_t) noexcept {
+
+                memory->live.fetch_sub(1, std::memory_order_release);
+
+            }
+
+
+            template <typename U>
+            bool operator==(const arena_allocator<U>& other) const noexcept {
+
+                return memory == other.memory;
+
+            }
+
+
+        }; /// struct arena_allocator
+
+
+        /// @brief The comparisons between the values of two nodes.
+        enum class comparison : uint8_t { greater, less, greater_equal, less_equal };
+
+
+        /// @brief A comparison between the values of two nodes taken while recording.
+        /// @note  The branches are checked again when a compiled graph is replayed, since the graph 
+        ///        recorded after the comparison depends on its result.
+        struct branch {
+
+            std::shared_ptr<expr_base> l, r; ///< The compared nodes.
+
+            comparison cmp; ///< The comparison.
+
+            bool taken; ///< The result of the comparison when it has been recorded.
+
+        }; /// struct branch
+
+
+        /// @brief The key identifying a node by its type and its operands, for interning the structurally identical nodes.
+        /// @note  The operations are identified by their operands, the constants by their value.
+        struct node_key {
+
+
+            std::type_index type; ///< The type of the node.
+
+            std::array<const void*, 3> operands{}; ///< The operands of the node, if it is an operation.
+
+            uint64_t value{}; ///< The bits of the value of the node, if it is a constant.
+
+
+            /// Return the key of a node of type NODE constructed from a value and some operands.
+            template <typename NODE, typename V, typename... Us>
+            static node_key of(const V& value, const Us&... operands) noexcept {
+
+                node_key key{typeid(NODE)};
+
+                if constexpr (sizeof...(Us) == 0)
+                    key.value = std::bit_cast<uint64_t>(static_cast<double>(adjoint_cast<erased_t<V>>(value)));
+                else {
+                    size_t i{};
+                    ((key.operands[i++] = operands.get()), ...);
+                }
+
+                return key;
+
+            }
+
+
+            bool operator==(const node_key&) const noexcept = default;
+
+
+            /// @brief The hash of a key.
+            struct hash {
+
+                size_t operator()(const node_key& key) const noexcept {
+
+                    size_t seed = key.type.hash_code();
+                    auto combine = [&](size_t h) { seed ^= h + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2); };
+
+                    for (auto operand : key.operands)
+                        combine(std::hash<const void*>{}(operand));
+                    combine(std::hash<uint64_t>{}(key.value));
+
+                    return seed;
+
+                }
+
+            }; /// struct hash
+
+
+        }; /// struct node_key
+
+
+        /// @brief Whether a node of type NODE constructed from some arguments can be interned.
+        /// @note  The operations, built from a value and their operands, and the floating point constants are interned,
+        ///        while every variable is a node on its own.
+        template <typename NODE, typename... Args>
+        struct is_internable : std::false_type {};
+
+        template <typename T, typename V>
+            requires std::is_floating_point_v<erased_t<T>>
+        struct is_internable<constant_expr<T>, V> : std::true_type {};
+
+        template <typename NODE, typename V, typename... Us>
+            requires (sizeof...(Us) > 0 && sizeof...(Us) <= 3 && (is_expr_ptr_v<Us> && ...))
+        struct is_internable<NODE, V, Us...> : std::true_type {};
+
+        template <typename NODE, typename... Args>
+        inline static constexpr bool is_internable_v = is_internable<NODE, std::remove_cvref_t<Args>...>::value;
+
+
+        /// @brief The linear tape recording the expression nodes in creation order.
+        /// @note  Every thread owns its tape, accessible through tape::local().
+        ///        While recording, the nodes are allocated contiguously in the arena of the tape, 
+        ///        otherwise from the memory resource selected by a tape::allocation scope, if any.
+        ///        The recorded nodes may be released on any thread: the list of the nodes is guarded by a mutex,
+        ///        and the nodes still alive are detached from the tape when a recording scope ends.
+        struct tape {
+
+
+            std::shared_ptr<arena> memory{std::make_shared<arena>()}; ///< The memory of the recorded nodes, shared with their allocators.
+
+            std::vector<expr_base*> nodes; ///< The recorded nodes in creation order.
+
+            mutable std::mutex guard; ///< The mutex guarding the list of the recorded nodes.
+
+            std::vector<branch> branches; ///< The comparisons taken while recording.
+
+            std::unordered_map<node_key, std::weak_ptr<expr_base>, node_key::hash> interned; ///< The interned nodes, while simplifying.
+
+            bool recording{false}; ///< Whether the new nodes are recorded on this tape.
+
+            bool simplifying{false}; ///< Whether the new nodes are interned and the constant operations folded.
+
+            std::pmr::memory_resource* resource{nullptr}; ///< The memory of the nodes not recorded and of the adjoint buffers, if selected.
+
+
+            tape() = default;
+
+            tape(const tape&) = delete;
+
+            tape& operator=(const tape&) = delete;
+
+
+            /// Detach the nodes still alive, leaving the arena to their allocators.
+            ~tape() {
+
+                branches.clear();
+                interned.clear();
+                this->detach();
+
+            }
+
+
+            /// Return the tape of the calling thread.
+            static tape& local() noexcept {
+
+                thread_local tape instance;
+                return instance;
+
+            }
+
+
+            /// Start recording the new nodes.
+            constexpr void start() noexcept {
+
+                recording = true;
+
+            }
+
+            /// Stop recording the new nodes.
+            constexpr void stop() noexcept {
+
+                recording = false;
+
+            }
+
+
+            /// Forget all the recorded nodes and branches, and make their memory available again.
+            /// @note  Throws a std::logic_error if some recorded node is still referenced.
+            void reset() {
+
+                if (!this->release())
+                    throw std::logic_error("Cannot reset a tape with " + std::to_string(this->live()) + " nodes still in use.");
+
+            }
+
+            /// Forget all the recorded nodes and branches, and make their memory available again if none of them is still referenced.
+            /// @note  Return whether the memory has been made available: otherwise the arena stays in use until a later reset.
+            bool release() noexcept {
+
+                branches.clear();
+                interned.clear();
+                this->detach();
+
+                if (this->live())
+                    return false;
+
+                memory->release();
+                return true;
+
+            }
+
+
+            /// Return the number of recorded nodes.
+            size_t size() const noexcept {
+
+                std::lock_guard lock(guard);
+                return nodes.size();
+
+            }
+
+            /// Return the number of recorded nodes still referenced.
+            size_t live() const noexcept {
+
+                return memory->live.load(std::memory_order_acquire);
+
+            }
+
+
+            /// Record a new node on this tape.
+            void record(expr_base* node) {
+
+                std::lock_guard lock(guard);
+                node->index = nodes.size();
+                nodes.push_back(node);
+                node->owner.store(this, std::memory_order_release);
+
+            }
+
+            /// Remove a destroyed node from this tape, unless it has been detached in the meantime.
+            void forget(const expr_base* node) noexcept {
+
+                std::lock_guard lock(guard);
+                if (node->index < nodes.size() && nodes[node->index] == node)
+                    nodes[node->index] = nullptr;
+
+            }
+
+            /// Detach the recorded nodes still alive, so that their destruction no longer touches this tape.
+            void detach() noexcept {
+
+                std::lock_guard lock(guard);
+                for (auto node : nodes)
+                    if (node)
+                        node->owner.store(nullptr, std::memory_order_release);
+                nodes.clear();
+
+            }
+
+
+            /// @brief Scoped recording on the tape of the calling thread.
+            /// @note  The nodes still referenced are detached when the scope ends, 
+            ///        and the memory of the tape is released if none of them is left.
+            struct scope {
+
+                tape& t;
+
+                scope() noexcept : t(tape::local()) { t.start(); }
+
+                ~scope() {
+
+                    t.stop();
+                    t.release();
+
+                }
+
+            }; /// struct scope
+
+
+            /// @brief Scoped simplification of the graphs built on the calling thread.
+            /// @note  The structurally identical nodes are built once, and the operations on constants are folded.
+            ///        The interned nodes are forgotten when the outermost scope ends.
+            struct simplification {
+
+                tape& t;
+
+                bool previous;
+
+                simplification() noexcept : t(tape::local()), previous(t.simplifying) { t.simplifying = true; }
+
+                ~simplification() {
+
+                    t.simplifying = previous;
+                    if (!previous)
+                        t.interned.clear();
+
+                }
+
+            }; /// struct simplification
+
+
+            /// @brief Scoped allocation of the nodes not recorded and of the adjoint buffers from a memory resource.
+            /// @note  A std::pmr::monotonic_buffer_resource suits the graphs built and discarded at once, 
+            ///        a std::pmr::unsynchronized_pool_resource the graphs kept alive while new nodes are built. 
+            ///        The resource is only selected for the calling thread, and it has to outlive all the nodes
+            ///        and the buffers allocated from it, even after the scope ends.
+            struct allocation {
+
+                tape& t;
+
+                std::pmr::memory_resource* previous;
+
+                explicit allocation(std::pmr::memory_resource* resource) noexcept : 
+                    t(tape::local()), previous(t.resource) { t.resource = resource; }
+
+                ~allocation() { t.resource = previous; }
+
+            }; /// struct allocation
+
+
+        }; /// struct tape
+
+
+        /// @brief Return the memory resource selected on the tape of the calling thread, or the default one.
+        inline std::pmr::memory_resource* selected_resource() noexcept {
+
+            const auto resource = tape::local().resource;
+            return resource ? resource : std::pmr::get_default_resource();
+
+        }
+
+
+        inline expr_base::~expr_base() {
+
+            if (auto t = owner.load(std::memory_order_acquire))
+                t->forget(this);
+
+        }
+
+
+        /// @brief Allocate a new expression node, recording it on a tape if it is recording.
+        /// @note  A node not recorded is allocated from the memory resource selected on the tape, if any, 
+        ///        together with its reference counts.
+        template <typename NODE, typename... Args>
+        inline std::shared_ptr<NODE> allocate_expr(tape& t, Args&&... args) {
+
+            if (!t.recording) {
+
+                if (t.resource)
+                    return std::allocate_shared<NODE>(std::pmr::polymorphic_allocator<NODE>(t.resource), std::forward<Args>(args)...);
+
+                return std::make_shared<NODE>(std::forward<Args>(args)...);
+
+            }
+
+            auto node = std::allocate_shared<NODE>(arena_allocator<NODE>(t.memory), std::forward<Args>(args)...);
+            t.record(node.get());
+
+            return node;
+
+        }
+
+
+        /// @brief Create a new expression node, recording it on the tape of the calling thread if it is recording.
+        /// @note  While the tape is simplifying, a node structurally identical to a node still alive is not created again:
+        ///        the existing node is returned, with its value refreshed if its operands have changed since.
+        template <typename NODE, typename... Args>
+        inline std::shared_ptr<NODE> make_expr(Args&&... args) {
+
+            auto& t = tape::local();
+
+            if constexpr (is_internable_v<NODE, Args...>) 
+                if (t.simplifying) {
+
+                    const auto key = node_key::of<NODE>(args...);
+                    auto& slot = t.interned[key];
+
+                    if (auto node = std::static_pointer_cast<NODE>(slot.lock())) {
+
+                        if constexpr (sizeof...(Args) > 1) {
+
+                            const auto generation = node->children_generation();
+                            if (generation > node->generation) {
+                                node->val = std::get<0>(std::forward_as_tuple(args...));
+                                node->generation = generation;
+                            }
+
+                        }
+
+                        return node;
+
+                    }
+
+                    auto node = allocate_expr<NODE>(t, std::forward<Args>(args)...);
+                    slot = node;
+
+                    return node;
+
+                }
+
+            return allocate_expr<NODE>(t, std::forward<Args>(args)...);
+
+        }
+
+
+        /// @brief Return whether a node is a constant, while the tape of the calling thread is simplifying.
+        template <typename T>
+        inline bool is_constant(const expr_ptr<T>& x) noexcept {
+
+            return tape::local().simplifying && dynamic_cast<const constant_expr<T>*>(x.get());
+
+        }
+
+        /// @brief Return whether a node is a given constant, while the tape of the calling thread is simplifying.
+        template <typename T>
+        inline bool is_constant(const expr_ptr<T>& x, const T& value) noexcept {
+
+            return is_constant(x) && x->val == value;
+
+        }
+
+
+        /// @brief Create the node of an operation on some operands, with the value computed from them.
+        /// @note  While the tape of the calling thread is simplifying, an operation on constants is folded into a constant.
+        template <typename NODE, typename... Us>
+        inline expr_ptr<typename NODE::value_t> make_operation(const typename NODE::value_t& value, const expr_ptr<Us>&... operands) {
+
+            if ((is_constant(operands) && ...))
+                return make_expr<constant_expr<typename NODE::value_t>>(value);
+
+            return make_expr<NODE>(value, operands...);
+
+        }
+
+
+    } // namespace calculus
+
+
+} // namespace scipp::math
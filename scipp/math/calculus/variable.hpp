@@ -25,7 +25,7 @@ namespace scipp::math {
 
 
             /// Construct a default variable object
-            constexpr variable() noexcept : variable(0.0) {}
+            constexpr variable() noexcept : variable(value_t{}) {}
 
             /// Construct a copy of a variable object
             constexpr variable(const variable& other) noexcept : variable(other.expr) {}
@@ -37,11 +37,11 @@ namespace scipp::math {
             /// Construct a variable object with given arithmetic value
             template <typename U>
             constexpr variable(const U& val) noexcept :
-                expr(std::make_shared<independent_variable_expr<value_t>>(val)) {}
+                expr(make_expr<independent_variable_expr<value_t>>(val)) {}
 
             /// Construct a variable object with given expression
             constexpr variable(const expr_ptr<value_t>& e) noexcept :
-                expr(std::make_shared<dependent_variable_expr<value_t>>(e)) {}
+                expr(make_expr<dependent_variable_expr<value_t>>(e)) {}
 
 
             /// Destruct a variable object
@@ -88,9 +88,10 @@ namespace scipp::math {
 
 
             /// Update the value of this variable with changes in its expression tree
+            /// @note  Only the subexpressions depending on the changed variables are recomputed.
             constexpr void update() {
 
-                this->expr->update();
+                forward_sweep(this->expr.get());
                 
             }
 
@@ -100,7 +101,7 @@ namespace scipp::math {
                 if (auto independent_expr = std::dynamic_pointer_cast<independent_variable_expr<value_t>>(this->expr)) {
 
                     independent_expr->val = value;
-                    independent_expr->update();
+                    independent_expr->generation = next_generation();
 
                 } else
                     throw std::logic_error("Cannot update the value of a dependent expression stored in a variable");
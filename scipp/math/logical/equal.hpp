@@ -83,6 +83,20 @@ namespace scipp::math {
         };
 
 
+
+        template <typename T1, typename T2>
+            requires (is_dual_v<T1> || is_dual_v<T2>)
+        struct equal_impl<T1, T2> {
+
+            static constexpr bool f(const T1& x, const T2& y) {
+
+                return equal(primal(x), primal(y));
+
+            }
+
+        };
+
+
     } // namespace op
 
 
@@ -54,6 +54,34 @@ namespace scipp::math {
         };
 
 
+
+        template <typename T1, typename T2>
+            requires (is_dual_v<T1> || is_dual_v<T2>)
+        struct less_equal_impl<T1, T2> {
+
+            static constexpr bool f(const T1& x, const T2& y) {
+
+                return less_equal(primal(x), primal(y));
+
+            }
+
+        };
+
+
+        /// @brief Less equal specialization for variables, recorded as a branch while taping
+        template <typename T1, typename T2>
+            requires (calculus::is_variable_v<T1> || calculus::is_variable_v<T2>)
+        struct less_equal_impl<T1, T2> {
+
+            static bool f(const T1& x, const T2& y) {
+
+                return calculus::compare(x, y, calculus::comparison::less_equal);
+
+            }
+
+        };
+
+
     } // namespace op
 
 
@@ -20,7 +20,7 @@ namespace scipp::math {
 
             static constexpr calculus::expr_ptr<T> f(const calculus::expr_ptr<T>& x) {
 
-                return std::make_shared<calculus::absolute_expr<T>>(abs(x->val), x);
+                return calculus::make_operation<calculus::absolute_expr<T>>(abs(x->val), x);
 
             }
 
@@ -87,6 +87,22 @@ namespace scipp::math {
         };
 
 
+
+        /// @brief Absolute value specialization for dual numbers
+        template <typename T>
+            requires is_dual_v<T>
+        struct absolute_impl<T> {
+
+            static constexpr auto f(const T& x) noexcept {
+
+                using V = typename T::value_t;
+                return x.chain(op::abs(x.real), op::less(x.real, V{}) ? -1.0 : 1.0);
+
+            }
+
+        };
+
+
     } /// namespace op
 
 
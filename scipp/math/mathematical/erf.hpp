@@ -20,7 +20,7 @@ namespace scipp::math {
 
             static constexpr calculus::expr_ptr<T> f(const calculus::expr_ptr<T>& x) {
 
-                return std::make_shared<calculus::erf_expr<T>>(erf(x->val), x);
+                return calculus::make_operation<calculus::erf_expr<T>>(erf(x->val), x);
 
             }
 
@@ -87,6 +87,21 @@ namespace scipp::math {
         };
 
 
+
+        /// @brief Error function specialization for dual numbers
+        template <typename T>
+            requires is_dual_v<T>
+        struct erf_impl<T> {
+
+            static constexpr auto f(const T& x) noexcept {
+
+                return x.chain(op::erf(x.real), op::mult(2.0 / std::sqrt(std::numbers::pi), op::exp(op::neg(op::square(x.real)))));
+
+            }
+
+        };
+
+
     } /// namespace op
 
 
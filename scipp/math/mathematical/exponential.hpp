@@ -20,7 +20,7 @@ namespace scipp::math {
 
             static constexpr calculus::expr_ptr<T> f(const calculus::expr_ptr<T>& x) {
 
-                return std::make_shared<calculus::exponential_expr<T>>(abs(x->val), x);
+                return calculus::make_operation<calculus::exponential_expr<T>>(exp(x->val), x);
 
             }
 
@@ -90,6 +90,37 @@ namespace scipp::math {
         // };
 
 
+
+        /// @brief Exponential specialization for dual numbers
+        template <typename T>
+            requires is_dual_v<T>
+        struct exponential_impl<T> {
+
+            static constexpr auto f(const T& x) noexcept {
+
+                using V = typename T::value_t;
+                const V exp_x = op::exp(x.real);
+                return x.chain(exp_x, exp_x);
+
+            }
+
+        };
+
+
+        /// @brief Exponential specialization for static expressions
+        template <typename T>
+            requires calculus::is_static_expr_v<T>
+        struct exponential_impl<T> {
+
+            static constexpr calculus::static_exponential_expr<T> f(const T& x) noexcept {
+
+                return {x};
+
+            }
+
+        };
+
+
     } // namespace op
 
 
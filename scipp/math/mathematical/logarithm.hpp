@@ -20,7 +20,7 @@ namespace scipp::math {
 
             static constexpr calculus::expr_ptr<T> f(const calculus::expr_ptr<T>& x) {
 
-                return std::make_shared<calculus::logarithm_expr<T>>(abs(x->val), x);
+                return calculus::make_operation<calculus::logarithm_expr<T>>(log(x->val), x);
 
             }
 
@@ -45,7 +45,7 @@ namespace scipp::math {
 
             static constexpr auto f(const T& x) {
                     
-                if (x <= 0.0) 
+                if (x <= T{}) 
                     throw std::invalid_argument("logarithm of a negative number is not defined");
 
                 return std::log(x);
@@ -92,6 +92,36 @@ namespace scipp::math {
         };
 
 
+
+        /// @brief Logarithm specialization for dual numbers
+        template <typename T>
+            requires is_dual_v<T>
+        struct logarithm_impl<T> {
+
+            static constexpr auto f(const T& x) noexcept {
+
+                using V = typename T::value_t;
+                return x.chain(V(op::log(x.real)), op::inv(x.real));
+
+            }
+
+        };
+
+
+        /// @brief Logarithm specialization for static expressions
+        template <typename T>
+            requires calculus::is_static_expr_v<T>
+        struct logarithm_impl<T> {
+
+            static constexpr calculus::static_logarithm_expr<T> f(const T& x) noexcept {
+
+                return {x};
+
+            }
+
+        };
+
+
     } // namespace op
 
 
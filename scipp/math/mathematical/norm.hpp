@@ -18,9 +18,13 @@ namespace scipp::math {
         template <typename T>
         struct norm_impl<calculus::expr_ptr<T>> {
 
-            static constexpr calculus::expr_ptr<T> f(const calculus::expr_ptr<T>& x) {
+            using value_t = decltype(norm(std::declval<T>()));
 
-                return std::make_shared<calculus::norm_expr<T>>(norm(x->val), x);
+            using result_t = calculus::expr_ptr<value_t>;
+
+            static constexpr result_t f(const calculus::expr_ptr<T>& x) {
+
+                return calculus::make_operation<calculus::norm_expr<value_t, T>>(norm(x->val), x);
 
             }
 
@@ -30,7 +34,7 @@ namespace scipp::math {
         template <typename T>
         struct norm_impl<calculus::variable<T>> {
 
-            static constexpr calculus::expr_ptr<T> f(const calculus::variable<T>& x) {
+            static constexpr auto f(const calculus::variable<T>& x) {
 
                 return norm(x.expr); 
 
@@ -40,7 +44,7 @@ namespace scipp::math {
 
 
         template <typename T>
-            requires is_number_v<T> || physics::is_measurement_v<T>
+            requires is_number_v<T> || physics::is_measurement_v<T> || is_dual_v<T>
         struct norm_impl<T> {
 
             static constexpr T f(const T& other) noexcept {
@@ -68,10 +72,11 @@ namespace scipp::math {
             requires geometry::is_vector_v<T>
         struct norm_impl<T> {
 
-            static constexpr typename T::value_t f(const T& other) noexcept {
+            using result_t = typename T::value_t;
+
+            static constexpr result_t f(const T& other) noexcept {
 
-                // return sqrt(dot(other, other));
-                return sqrt(sum(square(other)));
+                return sqrt(dot(other, other));
 
             }
 
@@ -20,7 +20,7 @@ namespace scipp::math {
 
             static constexpr calculus::expr_ptr<T> f(const calculus::expr_ptr<T>& x) {
 
-                return std::make_shared<calculus::cosine_expr<T>>(cos(x->val), x);
+                return calculus::make_operation<calculus::cosine_expr<T>>(cos(x->val), x);
 
             }
 
@@ -87,6 +87,35 @@ namespace scipp::math {
         };
 
 
+
+        /// @brief Cosine specialization for dual numbers
+        template <typename T>
+            requires is_dual_v<T>
+        struct cosine_impl<T> {
+
+            static constexpr auto f(const T& x) noexcept {
+
+                return x.chain(op::cos(x.real), op::neg(op::sin(x.real)));
+
+            }
+
+        };
+
+
+        /// @brief Cosine specialization for static expressions
+        template <typename T>
+            requires calculus::is_static_expr_v<T>
+        struct cosine_impl<T> {
+
+            static constexpr calculus::static_cosine_expr<T> f(const T& x) noexcept {
+
+                return {x};
+
+            }
+
+        };
+
+
     } // namespace op
 
 
@@ -20,7 +20,7 @@ namespace scipp::math {
 
             static constexpr calculus::expr_ptr<T> f(const calculus::expr_ptr<T>& x) {
 
-                return std::make_shared<calculus::hyperbolic_cosine_expr<T>>(cosh(x->val), x);
+                return calculus::make_operation<calculus::hyperbolic_cosine_expr<T>>(cosh(x->val), x);
 
             }
 
@@ -113,6 +113,21 @@ namespace scipp::math {
 		};
 
 
+
+        /// @brief Hyperbolic cosine specialization for dual numbers
+        template <typename T>
+            requires is_dual_v<T>
+        struct hyperbolic_cosine_impl<T> {
+
+            static constexpr auto f(const T& x) noexcept {
+
+                return x.chain(op::cosh(x.real), op::sinh(x.real));
+
+            }
+
+        };
+
+
     } // namespace op
 
 
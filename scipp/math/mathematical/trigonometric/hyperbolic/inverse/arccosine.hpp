@@ -20,7 +20,7 @@ namespace scipp::math {
 
             static constexpr calculus::expr_ptr<T> f(const calculus::expr_ptr<T>& x) {
 
-                return std::make_shared<calculus::hyperbolic_arccosine_expr<T>>(acosh(x->val), x);
+                return calculus::make_operation<calculus::hyperbolic_arccosine_expr<T>>(acosh(x->val), x);
 
             }
 
@@ -113,6 +113,22 @@ namespace scipp::math {
 		};
 
 
+
+        /// @brief Hyperbolic arccosine specialization for dual numbers
+        template <typename T>
+            requires is_dual_v<T>
+        struct hyperbolic_arccosine_impl<T> {
+
+            static constexpr auto f(const T& x) noexcept {
+
+                using V = typename T::value_t;
+                return x.chain(op::acosh(x.real), op::inv(op::sqrt(op::sub(op::square(x.real), V(1.0)))));
+
+            }
+
+        };
+
+
     } // namespace op
 
 
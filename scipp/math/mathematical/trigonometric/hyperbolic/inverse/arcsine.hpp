@@ -20,7 +20,7 @@ namespace scipp::math {
 
             static constexpr calculus::expr_ptr<T> f(const calculus::expr_ptr<T>& x) {
 
-                return std::make_shared<calculus::hyperbolic_arcsine_expr<T>>(asinh(x->val), x);
+                return calculus::make_operation<calculus::hyperbolic_arcsine_expr<T>>(asinh(x->val), x);
 
             }
 
@@ -113,6 +113,22 @@ namespace scipp::math {
 		};
 
 
+
+        /// @brief Hyperbolic arcsine specialization for dual numbers
+        template <typename T>
+            requires is_dual_v<T>
+        struct hyperbolic_arcsine_impl<T> {
+
+            static constexpr auto f(const T& x) noexcept {
+
+                using V = typename T::value_t;
+                return x.chain(op::asinh(x.real), op::inv(op::sqrt(op::add(op::square(x.real), V(1.0)))));
+
+            }
+
+        };
+
+
     } // namespace op
 
 
@@ -20,7 +20,7 @@ namespace scipp::math {
 
             static constexpr calculus::expr_ptr<T> f(const calculus::expr_ptr<T>& x) {
 
-                return std::make_shared<calculus::hyperbolic_tangent_expr<T>>(tanh(x->val), x);
+                return calculus::make_operation<calculus::hyperbolic_tangent_expr<T>>(tanh(x->val), x);
 
             }
 
@@ -114,6 +114,21 @@ namespace scipp::math {
 		};
 
 
+
+        /// @brief Hyperbolic tangent specialization for dual numbers
+        template <typename T>
+            requires is_dual_v<T>
+        struct hyperbolic_tangent_impl<T> {
+
+            static constexpr auto f(const T& x) noexcept {
+
+                return x.chain(op::tanh(x.real), op::inv(op::square(op::cosh(x.real))));
+
+            }
+
+        };
+
+
     } // namespace op
 
 
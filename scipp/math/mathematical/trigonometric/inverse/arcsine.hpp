@@ -20,7 +20,7 @@ namespace scipp::math {
 
             static constexpr calculus::expr_ptr<T> f(const calculus::expr_ptr<T>& x) {
 
-                return std::make_shared<calculus::arcsine_expr<T>>(asin(x->val), x);
+                return calculus::make_operation<calculus::arcsine_expr<T>>(asin(x->val), x);
 
             }
 
@@ -87,6 +87,22 @@ namespace scipp::math {
         };
 
 
+
+        /// @brief Arcsine specialization for dual numbers
+        template <typename T>
+            requires is_dual_v<T>
+        struct arcsine_impl<T> {
+
+            static constexpr auto f(const T& x) noexcept {
+
+                using V = typename T::value_t;
+                return x.chain(op::asin(x.real), op::inv(op::sqrt(op::sub(V(1.0), op::square(x.real)))));
+
+            }
+
+        };
+
+
     } // namespace op
 
 
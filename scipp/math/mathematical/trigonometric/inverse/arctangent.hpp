@@ -20,7 +20,7 @@ namespace scipp::math {
 
             static constexpr calculus::expr_ptr<T> f(const calculus::expr_ptr<T>& x) {
 
-                return std::make_shared<calculus::tangent_expr<T>>(atan(x->val), x);
+                return calculus::make_operation<calculus::arctangent_expr<T>>(atan(x->val), x);
 
             }
 
@@ -115,6 +115,22 @@ namespace scipp::math {
 
 
 
+
+        /// @brief Arctangent specialization for dual numbers
+        template <typename T>
+            requires is_dual_v<T>
+        struct arctangent_impl<T> {
+
+            static constexpr auto f(const T& x) noexcept {
+
+                using V = typename T::value_t;
+                return x.chain(op::atan(x.real), op::inv(op::add(V(1.0), op::square(x.real))));
+
+            }
+
+        };
+
+
     } // namespace op
 
 
@@ -20,7 +20,7 @@ namespace scipp::math {
 
             static constexpr calculus::expr_ptr<T> f(const calculus::expr_ptr<T>& x) {
 
-                return std::make_shared<calculus::sine_expr<T>>(sin(x->val), x);
+                return calculus::make_operation<calculus::sine_expr<T>>(sin(x->val), x);
 
             }
 
@@ -113,6 +113,35 @@ namespace scipp::math {
 		// };
 
 
+
+        /// @brief Sine specialization for dual numbers
+        template <typename T>
+            requires is_dual_v<T>
+        struct sine_impl<T> {
+
+            static constexpr auto f(const T& x) noexcept {
+
+                return x.chain(op::sin(x.real), op::cos(x.real));
+
+            }
+
+        };
+
+
+        /// @brief Sine specialization for static expressions
+        template <typename T>
+            requires calculus::is_static_expr_v<T>
+        struct sine_impl<T> {
+
+            static constexpr calculus::static_sine_expr<T> f(const T& x) noexcept {
+
+                return {x};
+
+            }
+
+        };
+
+
     } // namespace op
 
 
@@ -20,7 +20,7 @@ namespace scipp::math {
 
             static constexpr calculus::expr_ptr<T> f(const calculus::expr_ptr<T>& x) {
 
-                return std::make_shared<calculus::tangent_expr<T>>(tan(x->val), x);
+                return calculus::make_operation<calculus::tangent_expr<T>>(tan(x->val), x);
 
             }
 
@@ -87,6 +87,21 @@ namespace scipp::math {
         };
 
 
+
+        /// @brief Tangent specialization for dual numbers
+        template <typename T>
+            requires is_dual_v<T>
+        struct tangent_impl<T> {
+
+            static constexpr auto f(const T& x) noexcept {
+
+                return x.chain(op::tan(x.real), op::inv(op::square(op::cos(x.real))));
+
+            }
+
+        };
+
+
     } // namespace op
 
 
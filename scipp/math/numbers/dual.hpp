@@ -0,0 +1,216 @@
+/**
+ * @file    math/numbers/dual.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the implementation of the dual numbers used for forward mode automatic differentiation.
+ * @date    2023-06-12
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    /// @brief dual number struct
+    /// @tparam T the type of the measurement
+    /// @tparam N the number of directional derivatives carried along with the value
+    /// @note   The tangents are the differentials of the value along N directions, so they share its type:
+    ///         the dimensional analysis is checked on the tangents as on the value, and no heap memory is used.
+    template <typename T, size_t N>
+        requires (is_number_v<T> || physics::is_measurement_v<T>)
+    struct dual<T, N> {
+
+
+        // ==============================================
+        // aliases
+        // ==============================================
+
+            /// @brief alias for the type of the class
+            using _t = dual<T, N>;
+
+            /// @brief alias for the type of the measurement
+            using value_t = T;
+
+            /// @brief alias for the type of the tangents pack
+            using tangent_t = std::array<T, N>;
+
+
+        // ==============================================
+        // members
+        // ==============================================
+
+            /// @brief value of the dual number
+            value_t real;
+
+            /// @brief tangents of the dual number
+            tangent_t imag;
+
+
+        // ==============================================
+        // static members
+        // ==============================================
+
+            /// @brief number of tangents of the dual number
+            inline static constexpr size_t dim = N;
+
+
+        // ==============================================
+        // constructors
+        // ==============================================
+
+            /// @brief default constructor
+            /// @details constructs a dual number with value 0 and epsilon 0
+            constexpr dual() noexcept :
+
+                real{}, imag{} {}
+
+
+            /// @brief constructor from a value
+            /// @details constructs a dual number with value val and epsilon 0
+            constexpr dual(const value_t& real) noexcept :
+
+                real{real}, imag{} {}
+
+            /// @brief constructor from a value
+            /// @details constructs a dual number with value val and epsilon 0
+            constexpr dual(value_t&& real) noexcept :
+
+                real{std::move(real)}, imag{} {}
+
+
+            /// @brief constructor from a value and an epsilon
+            /// @details constructs a dual number with value val and epsilon eps
+            constexpr dual(const value_t& real, const value_t& imag) noexcept requires (N == 1) :
+
+                real{real}, imag{imag} {}
+
+
+            /// @brief constructor from a value and the tangents
+            constexpr dual(const value_t& real, const tangent_t& imag) noexcept :
+
+                real{real}, imag{imag} {}
+
+
+            /// @brief copy constructor
+            constexpr dual(const dual& other) noexcept :
+
+                real{other.real}, imag{other.imag} {}
+
+            /// @brief move constructor
+            constexpr dual(dual&& other) noexcept :
+
+                real{std::move(other.real)}, imag{std::move(other.imag)} {}
+
+
+            /// @brief destructor
+            constexpr ~dual() = default;
+
+
+        // ==============================================
+        // operators
+        // ==============================================
+
+            /// @brief copy assignment operator
+            constexpr dual& operator=(const dual& other) noexcept {
+
+                this->real = other.real;
+                this->imag = other.imag;
+
+                return *this;
+
+            }
+
+            /// @brief move assignment operator
+            constexpr dual& operator=(dual&& other) noexcept {
+
+                this->real = std::move(other.real);
+                this->imag = std::move(other.imag);
+
+                return *this;
+
+            }
+
+
+        // ==============================================
+        // methods
+        // ==============================================
+
+            /// @brief Return a dual number with unitary tangent along the i-th direction
+            static constexpr dual seed(const value_t& real, size_t i) noexcept {
+
+                dual result(real);
+                result.imag[i] = value_t{1.0};
+
+                return result;
+
+            }
+
+
+            /// @brief Return the dual number of f(x), given the value of f and of its derivative in the value of x
+            template <typename R, typename D>
+            constexpr dual<R, N> chain(const R& fx, const D& dfx) const noexcept {
+
+                dual<R, N> result(fx);
+                for (size_t i{}; i < N; ++i)
+                    result.imag[i] = op::mult(dfx, this->imag[i]);
+
+                return result;
+
+            }
+
+
+            /// @brief Return the derivative w.r.t. the variable of type X seeded along the i-th direction
+            template <typename X>
+            constexpr op::divide_t<value_t, X> derivative(size_t i) const {
+
+                return op::div(this->imag[i], X{1.0});
+
+            }
+
+
+    }; /// dual struct
+
+
+    /// @brief Return the value of a dual number, or the argument itself
+    template <typename T>
+    inline static constexpr const auto& primal(const T& x) noexcept {
+
+        if constexpr (is_dual_v<T>)
+            return x.real;
+        else
+            return x;
+
+    }
+
+
+    /// @brief Return the dual numbers of the given values, each one seeded along its own direction
+    template <typename... Ts>
+        requires ((is_number_v<Ts> || physics::is_measurement_v<Ts>) && ...)
+    inline static constexpr auto make_duals(const Ts&... xs) noexcept {
+
+        constexpr size_t N = sizeof...(Ts);
+
+        return [&]<size_t... I>(std::index_sequence<I...>) {
+            return std::make_tuple(dual<Ts, N>::seed(xs, I)...);
+        }(std::index_sequence_for<Ts...>{});
+
+    }
+
+    /// @brief Return the dual numbers of the components of a vector, each one seeded along its own direction
+    template <typename VECTOR_TYPE>
+        requires geometry::is_vector_v<VECTOR_TYPE>
+    inline static constexpr auto make_duals(const VECTOR_TYPE& x) noexcept {
+
+        using dual_t = dual<typename VECTOR_TYPE::value_t, VECTOR_TYPE::dim>;
+
+        geometry::vector<dual_t, VECTOR_TYPE::dim, VECTOR_TYPE::flag> result;
+        for (size_t i{}; i < VECTOR_TYPE::dim; ++i)
+            result.data[i] = dual_t::seed(x.data[i], i);
+
+        return result;
+
+    }
+
+
+} /// namespace scipp::math
@@ -0,0 +1,70 @@
+/**
+ * @file    math/numerical/prod.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   
+ * @date    2023-07-29
+ * 
+ * @copyright Copyright (c) 2023
+ */
+
+
+
+namespace scipp::math {
+
+
+    namespace op {
+
+
+        template <typename T>
+            requires geometry::is_vector_v<T>
+        static constexpr auto prod(const T& x) {
+                
+            return std::accumulate(
+                x.data.begin(), x.data.end(), 
+                typename T::value_t{1}, 
+                [](const auto& a, const auto& b) {
+                    return a * b;
+                }
+            );
+
+        }
+
+
+        /// @brief Return the product of some expressions as a single node, whatever the number of factors.
+        template <typename T>
+            requires std::is_same_v<multiply_t<T, T>, T>
+        static constexpr calculus::expr_ptr<T> prod(std::vector<calculus::expr_ptr<T>> factors) {
+
+            if (factors.empty())
+                return calculus::constant<T>(T{1});
+
+            if (factors.size() == 1)
+                return factors.front();
+
+            T val{1};
+            for (const auto& x : factors)
+                val *= x->val;
+
+            return calculus::make_expr<calculus::product_expr<T>>(val, std::move(factors));
+
+        }
+
+        /// @brief Return the product of some variables as a single node, whatever the number of factors.
+        template <typename T>
+            requires std::is_same_v<multiply_t<T, T>, T>
+        static constexpr calculus::expr_ptr<T> prod(const std::vector<calculus::variable<T>>& factors) {
+
+            std::vector<calculus::expr_ptr<T>> exprs;
+            exprs.reserve(factors.size());
+            for (const auto& x : factors)
+                exprs.push_back(x.expr);
+
+            return prod(std::move(exprs));
+
+        }
+
+
+    } // namespace op
+
+
+} // namespace scipp::math
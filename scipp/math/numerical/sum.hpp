@@ -1,5 +1,5 @@
 /**
- * @file    math/numerical/round.hpp
+ * @file    math/numerical/sum.hpp
  * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
  * @brief   
  * @date    2023-07-18
@@ -30,6 +30,38 @@ namespace scipp::math {
         }
 
 
+        /// @brief Return the sum of some expressions as a single node, whatever the number of terms.
+        template <typename T>
+        static constexpr calculus::expr_ptr<T> sum(std::vector<calculus::expr_ptr<T>> terms) {
+
+            if (terms.empty())
+                return calculus::constant<T>(T{});
+
+            if (terms.size() == 1)
+                return terms.front();
+
+            T val{};
+            for (const auto& x : terms)
+                val += x->val;
+
+            return calculus::make_expr<calculus::sum_expr<T>>(val, std::move(terms));
+
+        }
+
+        /// @brief Return the sum of some variables as a single node, whatever the number of terms.
+        template <typename T>
+        static constexpr calculus::expr_ptr<T> sum(const std::vector<calculus::variable<T>>& terms) {
+
+            std::vector<calculus::expr_ptr<T>> exprs;
+            exprs.reserve(terms.size());
+            for (const auto& x : terms)
+                exprs.push_back(x.expr);
+
+            return sum(std::move(exprs));
+
+        }
+
+
     } // namespace op
 
 
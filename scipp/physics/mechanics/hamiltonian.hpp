@@ -27,7 +27,7 @@ namespace scipp::physics {
             
             : m{L.m}, x{L.x}, t{L.t}, potential{L.potential}  {
 
-            p = std::get<0>(calculus::derivatives(L(), calculus::wrt(L.x_dot)));
+            p = calculus::derivatives(L(), calculus::wrt(L.x_dot));
 
         }
 
@@ -157,6 +157,60 @@ namespace scipp::physics {
         }
       
 
+        /// @brief Return the phase space after a rk4 step from given position and momentum, recorded as expressions of them.
+        /// @note  The derivatives of the hamiltonian are recorded by derivativesx, so that the step can be differentiated.
+        auto rk4_step(const calculus::variable<measurement<base::length>>& x0, 
+                      const calculus::variable<measurement<base::momentum>>& p0, 
+                      const measurement<base::time>& dt) {
+
+            auto flow = [&](const calculus::variable<measurement<base::length>>& q, const calculus::variable<measurement<base::momentum>>& k) {
+                calculus::variable<measurement<base::energy>> H = kinetic_energy(this->m, k) + this->potential(q);
+                return calculus::derivativesx(H, calculus::wrt(q, k));
+            };
+
+            auto [dHdx_initial, dHdp_initial] = flow(x0, p0);
+
+            calculus::variable<measurement<base::length>> x1 = x0 + 0.5 * dt * dHdp_initial;
+            calculus::variable<measurement<base::momentum>> p1 = p0 - 0.5 * dt * dHdx_initial;
+            auto [dHdx_intermediate1, dHdp_intermediate1] = flow(x1, p1);
+
+            calculus::variable<measurement<base::length>> x2 = x0 + 0.5 * dt * dHdp_intermediate1;
+            calculus::variable<measurement<base::momentum>> p2 = p0 - 0.5 * dt * dHdx_intermediate1;
+            auto [dHdx_intermediate2, dHdp_intermediate2] = flow(x2, p2);
+
+            calculus::variable<measurement<base::length>> x3 = x0 + dt * dHdp_intermediate2;
+            calculus::variable<measurement<base::momentum>> p3 = p0 - dt * dHdx_intermediate2;
+            auto [dHdx_final, dHdp_final] = flow(x3, p3);
+
+            return std::make_tuple(
+                calculus::variable<measurement<base::length>>(x0 + (dt / 6.0) * (dHdp_initial + 2.0 * dHdp_intermediate1 + 2.0 * dHdp_intermediate2 + dHdp_final)), 
+                calculus::variable<measurement<base::momentum>>(p0 - (dt / 6.0) * (dHdx_initial + 2.0 * dHdx_intermediate1 + 2.0 * dHdx_intermediate2 + dHdx_final))
+            );
+
+        }
+
+
+        /// @brief Return the derivatives of lambda . (x, p) after N rk4 steps up to tmax w.r.t. the current position and momentum.
+        /// @param lambda The derivatives of a function of the final phase space w.r.t. its position and momentum, without units.
+        /// @param snapshots The number of phase spaces stored at once while the evolution is reversed.
+        /// @note  The steps are reversed backward in time with binomial checkpointing, by adjoint_evolve, so the memory
+        ///        does not depend on N. The derivatives are returned without units, and the system is not evolved.
+        template <size_t N>
+        std::array<double, 2> sensitivity(const measurement<base::time>& tmax, const std::array<double, 2>& lambda, size_t snapshots) {
+
+            const auto dt = tmax / N;
+
+            auto step = [&](const std::tuple<calculus::variable<measurement<base::length>>, calculus::variable<measurement<base::momentum>>>& s) {
+                return this->rk4_step(std::get<0>(s), std::get<1>(s), dt);
+            };
+
+            const auto s0 = std::make_tuple(static_cast<measurement<base::length>>(this->x), static_cast<measurement<base::momentum>>(this->p));
+
+            return std::get<0>(calculus::adjoint_evolve(step, s0, N, lambda, snapshots));
+
+        }
+      
+
         // template <size_t N>
         // void plot_evolution(const measurement<base::time>& tmax) noexcept {
 
@@ -37,6 +37,27 @@ namespace scipp::physics {
     } 
 
 
+    /// @brief Return the kinetic energy of a mass with a velocity or a momentum given by a static expression.
+    template <typename V>
+        requires calculus::is_static_expr_v<V>
+    constexpr auto kinetic_energy(const measurement<base::mass>& mass, const V& v) noexcept {
+
+        if constexpr (std::is_same_v<typename V::value_t, measurement<base::momentum>>)
+            return 0.5 * math::op::square(v) / mass; 
+        else
+            return 0.5 * mass * math::op::square(v); 
+
+    } 
+
+    template <typename V>
+        requires calculus::is_static_expr_v<V>
+    constexpr auto kinetic_energy(const V& v, const measurement<base::mass>& mass) noexcept {
+
+        return kinetic_energy(mass, v); 
+
+    } 
+
+
     template <size_t N> 
     inline calculus::variable<measurement<base::energy>> kinetic_energy(const measurement<base::mass>& mass, const std::array<calculus::variable<measurement<base::velocity>>, N>& velocity) {
 
@@ -27,7 +27,7 @@ namespace scipp::physics {
 
         inline calculus::variable<measurement<base::force>> force(const calculus::variable<measurement<base::length>>& x) {
 
-            return -std::get<0>(calculus::derivatives(this->operator()(x), calculus::wrt(x))); 
+            return -calculus::derivatives(this->operator()(x), calculus::wrt(x)); 
 
         } 
 
@@ -52,6 +52,17 @@ namespace scipp::physics {
 
         }
 
+        /// @brief Return the potential energy at a distance given by a static expression.
+        template <typename X>
+            requires calculus::is_static_expr_v<X>
+        constexpr auto operator()(const X& x) const noexcept {
+
+            return std::apply([&](const auto&... args) {
+                return (args(x) + ...);
+            }, this->params);
+
+        }
+
     };
 
 
@@ -72,6 +83,16 @@ namespace scipp::physics {
 
             }
 
+            /// @brief Return the elastic potential energy at a distance given by a static expression.
+            template <typename X>
+                requires calculus::is_static_expr_v<X>
+            constexpr auto operator()(const X& x) const noexcept {
+
+                const auto& [k, l0] = this->params; 
+                return 0.5 * k * math::op::square(x - l0); 
+
+            }
+
         };
 
 
@@ -89,10 +110,31 @@ namespace scipp::physics {
 
             }
 
+            /// @brief Return the gravitational potential energy at a distance given by a static expression.
+            template <typename X>
+                requires calculus::is_static_expr_v<X>
+            constexpr auto operator()(const X& x) const noexcept {
+
+                const auto& [m1, m2] = this->params; 
+                return -physics::constants::G * m1 * m2 / x; 
+
+            }
+
         };
 
 
     } // namespace potentials
 
 
+    /// @brief Return the force of a potential at a distance given by a static variable.
+    /// @note  The potential is evaluated as a static expression, so that its derivative is inlined 
+    ///        without recording any node: the result is the same of potential::force.
+    template <typename POTENTIAL>
+    constexpr measurement<base::force> force(const POTENTIAL& V, const calculus::static_variable<measurement<base::length>>& x) noexcept {
+
+        return -calculus::derivatives(V(x), calculus::wrt(x)); 
+
+    }
+
+
 } // namespace scipp::physics
\ No newline at end of file
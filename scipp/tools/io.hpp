@@ -392,7 +392,10 @@ namespace scipp::tools {
         requires (math::is_dual_v<MEAS_TYPE>)
     static constexpr void print(const MEAS_TYPE& other) noexcept {
 
-        std::cout << other.real << " + ε(" << other.imag << ")\n";
+        std::cout << other.real;
+        for (size_t i{}; i < MEAS_TYPE::dim; ++i)
+            std::cout << " + ε" << i << "(" << other.imag[i] << ")";
+        std::cout << '\n';
 
     }
     
@@ -406,6 +409,56 @@ namespace scipp::tools {
     // }
 
 
+    template <bool NEWLINE = true, typename T>
+    inline static constexpr void print(const math::calculus::expr_ptr<T>& other) noexcept {
+
+        print<NEWLINE>(math::calculus::val(other));
+
+    }
+
+    template <bool NEWLINE = true, typename T>
+    inline static constexpr void print(const std::string& description, const math::calculus::expr_ptr<T>& other) noexcept {
+
+        print<NEWLINE>(description, math::calculus::val(other));
+
+    }
+
+
+    template <bool NEWLINE = true, typename T>
+    inline static constexpr void print(const math::calculus::expr_ptr<T>& other, const std::string& description) noexcept {
+
+        print<NEWLINE>(math::calculus::val(other), description);
+
+    }
+
+
+    /// @brief Print a variable
+    template <bool NEWLINE = true, typename T>
+    inline static void print(const math::calculus::variable<T>& x) noexcept {
+
+        print<NEWLINE>(math::calculus::val(x));
+
+    }
+    
+
+    /// @brief Print a variable with a description
+    template <bool NEWLINE = true, typename T>
+    inline static void print(const std::string& description, const math::calculus::variable<T>& x) noexcept {
+
+        print<NEWLINE>(description, math::calculus::val(x));
+
+    }
+
+
+    /// @brief Print a variable with a description
+    template <bool NEWLINE = true, typename T>
+    inline static void print(const math::calculus::variable<T>& x, const std::string& description) noexcept {
+
+        print<NEWLINE>(math::calculus::val(x), description);
+
+    }
+
+
     /// @brief Print a geometry::vector
     template <bool NEWLINE = true, typename VECTOR_TYPE>
         requires geometry::is_vector_v<VECTOR_TYPE>
@@ -527,54 +580,6 @@ namespace scipp::tools {
     }
 
 
-    template <bool NEWLINE = true, typename T>
-    inline static constexpr void print(const math::calculus::expr_ptr<T>& other) noexcept {
-
-        print<NEWLINE>(math::calculus::val(other));
-
-    }
-
-    template <bool NEWLINE = true, typename T>
-    inline static constexpr void print(const std::string& description, const math::calculus::expr_ptr<T>& other) noexcept {
-
-        print<NEWLINE>(description, math::calculus::val(other));
-
-    }
-
-
-    template <bool NEWLINE = true, typename T>
-    inline static constexpr void print(const math::calculus::expr_ptr<T>& other, const std::string& description) noexcept {
-
-        print<NEWLINE>(math::calculus::val(other), description);
-
-    }
-
-
-    /// @brief Print a variable
-    template <bool NEWLINE = true, typename T>
-    inline static void print(const math::calculus::variable<T>& x) noexcept {
-
-        print<NEWLINE>(math::calculus::val(x));
-
-    }
-    
-
-    /// @brief Print a variable with a description
-    template <bool NEWLINE = true, typename T>
-    inline static void print(const std::string& description, const math::calculus::variable<T>& x) noexcept {
-
-        print<NEWLINE>(description, math::calculus::val(x));
-
-    }
-
-
-    /// @brief Print a variable with a description
-    template <bool NEWLINE = true, typename T>
-    inline static void print(const math::calculus::variable<T>& x, const std::string& description) noexcept {
-
-        print<NEWLINE>(math::calculus::val(x), description);
-
-    }
 
 
     // /// @brief Print a geometry::MATRIX
@@ -137,4 +137,9 @@ namespace scipp::geometry {
         inline static constexpr bool are_matrix_v = are_matrix<Ts...>::value;
 
 
+        template <typename MATRIX_TYPE>
+            requires (is_matrix_v<MATRIX_TYPE>)
+        struct lu_factorization;
+
+
 } /// namespace scipp::geometry
\ No newline at end of file
@@ -80,7 +80,7 @@ namespace scipp::math {
     /// @brief dual numbers traits
     /// =============================================
 
-        template <typename T> 
+        template <typename T, size_t N = 1> 
         struct dual;
 
         template <typename T>
@@ -94,8 +94,8 @@ namespace scipp::math {
         template <typename T>
         struct is_dual : std::false_type {};
 
-        template <typename MEAS_TYPE>
-        struct is_dual<dual<MEAS_TYPE>> : std::true_type {};
+        template <typename MEAS_TYPE, size_t N>
+        struct is_dual<dual<MEAS_TYPE, N>> : std::true_type {};
 
         template <typename T>
         inline constexpr bool is_dual_v = is_dual<T>::value;
@@ -185,10 +185,16 @@ namespace scipp::math {
         template <typename T> 
         struct constant_expr; 
 
+        template <typename NODE, typename... Args>
+        inline std::shared_ptr<NODE> make_expr(Args&&... args);
+
+        template <typename NODE, typename... Us>
+        inline expr_ptr<typename NODE::value_t> make_operation(const typename NODE::value_t& value, const expr_ptr<Us>&... operands);
+
         template <typename T> 
         inline constexpr expr_ptr<T> constant(const T& val) { 
             
-            return std::make_shared<constant_expr<T>>(val); 
+            return make_expr<constant_expr<T>>(val); 
             
         }
 
@@ -219,6 +225,29 @@ namespace scipp::math {
         inline static constexpr bool are_variables_v = std::conjunction_v<is_variable<Ts>...>;
 
 
+        template <typename DERIVED>
+        struct static_expr; 
+
+        template <typename VALUE_T>
+        struct static_variable; 
+
+        /// @note The pointer conversion does not require T to be complete, as the variables are when this trait is first checked.
+        template <typename T>
+        struct is_static_expr : std::is_convertible<const T*, const static_expr<T>*> {};
+
+        template <typename T>
+        inline static constexpr bool is_static_expr_v = is_static_expr<T>::value; 
+
+        template <typename T>
+        struct is_static_variable : std::false_type {};
+
+        template <typename T>
+        struct is_static_variable<static_variable<T>> : std::true_type {};
+
+        template <typename T>
+        inline static constexpr bool is_static_variable_v = is_static_variable<T>::value; 
+
+
         template <typename T>
             requires std::is_arithmetic_v<T>
         constexpr T expr_value(const T &t) {
@@ -457,13 +486,13 @@ namespace scipp::math {
         }
 
 
-        template <size_t T1, typename T2>
+        template <int T1, typename T2>
         struct root_impl; 
 
-        template <size_t T1, typename T2>
+        template <int T1, typename T2>
         using root_t = typename root_impl<T1, T2>::result_t;
 
-        template <size_t T1, typename T2>
+        template <int T1, typename T2>
         inline static constexpr auto root(const T2& x) {
             
             return root_impl<T1, T2>::f(x); 
@@ -529,6 +558,132 @@ namespace scipp::math {
         }
 
 
+        template <typename T1, typename T2>
+        struct dot_impl;
+
+        template <typename T1, typename T2>
+        using dot_t = typename dot_impl<T1, T2>::result_t;
+
+        template <typename T1, typename T2>
+        inline static constexpr auto dot(const T1& x, const T2& y) noexcept {
+            
+            return dot_impl<T1, T2>::f(x, y); 
+
+        }
+
+
+        template <typename T1, typename T2>
+        struct cross_impl;
+
+        template <typename T1, typename T2>
+        using cross_t = typename cross_impl<T1, T2>::result_t;
+
+        template <typename T1, typename T2>
+        inline static constexpr auto cross(const T1& x, const T2& y) noexcept {
+            
+            return cross_impl<T1, T2>::f(x, y); 
+
+        }
+
+
+        template <typename T1, typename T2>
+        struct outer_impl;
+
+        template <typename T1, typename T2>
+        using outer_t = typename outer_impl<T1, T2>::result_t;
+
+        template <typename T1, typename T2>
+        inline static constexpr auto outer(const T1& x, const T2& y) noexcept {
+            
+            return outer_impl<T1, T2>::f(x, y); 
+
+        }
+
+
+        template <typename T>
+        struct transpose_impl;
+
+        template <typename T>
+        using transpose_t = typename transpose_impl<T>::result_t;
+
+        template <typename T>
+        inline static constexpr auto transpose(const T& x) noexcept {
+            
+            return transpose_impl<T>::f(x); 
+
+        }
+
+
+        template <typename T>
+        struct stack_impl;
+
+        template <typename T>
+        using stack_t = typename stack_impl<T>::result_t;
+
+        template <typename T>
+        inline static constexpr auto stack(const T& x) noexcept {
+            
+            return stack_impl<T>::f(x); 
+
+        }
+
+
+        template <typename T>
+        struct component_impl;
+
+        template <typename T>
+        using component_t = typename component_impl<T>::result_t;
+
+        template <typename T>
+        inline static constexpr auto component(const T& x, size_t i) {
+            
+            return component_impl<T>::f(x, i); 
+
+        }
+
+
+        template <typename T>
+        struct inverse_impl;
+
+        template <typename T>
+        using inverse_t = typename inverse_impl<T>::result_t;
+
+        template <typename T>
+        inline static constexpr auto inverse(const T& x) {
+            
+            return inverse_impl<T>::f(x); 
+
+        }
+
+
+        template <typename T>
+        struct determinant_impl;
+
+        template <typename T>
+        using determinant_t = typename determinant_impl<T>::result_t;
+
+        template <typename T>
+        inline static constexpr auto determinant(const T& x) {
+            
+            return determinant_impl<T>::f(x); 
+
+        }
+
+
+        template <typename T1, typename T2>
+        struct solve_impl;
+
+        template <typename T1, typename T2>
+        using solve_t = typename solve_impl<T1, T2>::result_t;
+
+        template <typename T1, typename T2>
+        inline static constexpr auto solve(const T1& x, const T2& y) {
+            
+            return solve_impl<T1, T2>::f(x, y); 
+
+        }
+
+
         template <typename T>
         struct exponential_impl;
 
@@ -0,0 +1,112 @@
+/**
+ * @file    test/compile.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the test of the compiled programs against the graphs they are compiled from.
+ *          Testing y = cbrt(x) + root<5>(x) at negative and positive points, whose odd roots are real:
+ *          the values and the derivatives of the program, on a single point and on a batch of points,
+ *          are compared with the ones of the graph.
+ *          Testing also the guards of the branches compared with values and with constant nodes of measurements,
+ *          and v = q / t compiled on measurements, as in docs/math/autodiff.md.
+ * @date    2023-07-26
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::physics;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// Return whether two values are equal up to the rounding
+bool close(double computed, double expected) {
+
+    return std::abs(computed - expected) <= 1e-12 * std::max(1.0, std::abs(expected));
+
+}
+
+
+// Build the graph at a given point
+variable<double> model(const variable<double>& x) {
+
+    return op::cbrt(x) + op::root<5>(x);
+
+}
+
+
+int main() {
+
+    const std::vector<double> points{-8.0, -2.5, -0.3, 0.3, 2.5, 8.0};
+
+    variable<double> x = points[0];
+    auto program = compile(model(x), wrt(x));
+
+    std::vector<double> y(points.size()), dy(points.size());
+    program.gradient(y, {dy}, points);
+
+    size_t failed{};
+    for (size_t i{}; i < points.size(); ++i) {
+
+        x = points[i];
+        const variable<double> expected = model(x);
+        const double value = val(expected), derivative = derivatives(expected, wrt(x));
+
+        if (std::isnan(value) || !close(value, std::cbrt(points[i]) + std::copysign(std::pow(std::abs(points[i]), 0.2), points[i])))
+            std::cerr << "graph at " << points[i] << ": " << value << '\n', ++failed;
+
+        if (!close(program.eval(points[i]), value) || !close(y[i], value))
+            std::cerr << "program at " << points[i] << ": " << program.eval(points[i]) << " and " << y[i] << ", expected " << value << '\n', ++failed;
+
+        if (!close(program.gradient(points[i]), derivative) || !close(dy[i], derivative))
+            std::cerr << "derivative at " << points[i] << ": " << program.gradient(points[i]) << " and " << dy[i] << ", expected " << derivative << '\n', ++failed;
+
+    }
+
+    {
+
+        variable<measurement<base::length>> q = 2.0 * units::m; 
+        variable<measurement<base::time>> t = 4.0 * units::s; 
+        variable<measurement<base::velocity>> v = q / t; 
+
+        auto program = compile(v, wrt(q, t)); 
+
+        auto v1 = program.eval(3.0 * units::m, 2.0 * units::s); // 1.5 m/s
+        auto [dv_dq, dv_dt] = program.gradient(3.0 * units::m, 2.0 * units::s); 
+
+        if (!close(v1.value, 1.5) || !close(dv_dq.value, 0.5) || !close(dv_dt.value, -0.75))
+            std::cerr << "program of measurements: " << v1 << ", " << dv_dq << ", " << dv_dt << '\n', ++failed;
+
+    }
+
+    {
+
+        tape::scope recording;
+
+        variable<double> u = 1.0;
+        variable<double> v = (u > 0.0) ? u * u : -u;
+
+        variable<measurement<base::length>> q = 1.0 * units::m;
+        const variable<measurement<base::length>> threshold = constant(0.5 * units::m);
+        variable<measurement<base::length>> r = (q > threshold) ? q * 2.0 : q * 3.0;
+
+        auto guarded = compile(v, wrt(u));
+        auto guarded_measurement = compile(r, wrt(q));
+
+        guarded.eval(2.0);
+        guarded_measurement.eval(2.0 * units::m);
+        if (!guarded.valid() || !guarded_measurement.valid())
+            std::cerr << "guards not holding on the recorded branch\n", ++failed;
+
+        guarded.eval(-2.0);
+        guarded_measurement.eval(0.2 * units::m);
+        if (guarded.valid() || guarded_measurement.valid())
+            std::cerr << "guards holding on the branch not recorded\n", ++failed;
+
+    }
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+
+}
@@ -0,0 +1,110 @@
+/**
+ * @file    test/concurrent.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the test of the derivatives computed concurrently by many threads.
+ *          Testing y = sum_k p_k sin(p_k x) over a set of parameters p shared by all the threads:
+ *          every thread differentiates both a graph shared by all the threads and a graph of its own,
+ *          and its gradients are compared with the ones computed serially before the threads are started.
+ * @date    2023-07-25
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "scipp"
+
+#include <thread>
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+inline constexpr size_t terms = 256;
+
+inline constexpr size_t threads = 8;
+
+inline constexpr size_t repetitions = 64;
+
+
+using gradient_t = std::tuple<double, double, double, double>;
+
+
+// The parameters shared by all the threads
+const std::array<variable<double>, 4> params{0.5, 1.0, 1.5, 2.0};
+
+
+// Build the model at a given input
+variable<double> model(double x0) {
+
+    variable<double> y = 0.0;
+    for (size_t i{}; i < terms; ++i) {
+
+        const auto& p = params[i % params.size()];
+        y = y + p * op::sin(p * (x0 / terms));
+
+    }
+
+    return y;
+
+}
+
+
+// Return the gradient of a model w.r.t. the parameters
+gradient_t gradient(const variable<double>& y) {
+
+    return derivatives(y, wrt(params[0], params[1], params[2], params[3]));
+
+}
+
+
+int main() {
+
+    const variable<double> shared = model(1.0);
+
+    // The serial reference, computed before any thread is started
+    const gradient_t shared_reference = gradient(shared);
+    std::array<gradient_t, threads> own_reference;
+    for (size_t t{}; t < threads; ++t)
+        own_reference[t] = gradient(model(2.0 + static_cast<double>(t)));
+
+    std::array<size_t, threads> failures{};
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    for (size_t t{}; t < threads; ++t) {
+
+        workers.emplace_back([&, t]() {
+
+            const auto own = model(2.0 + static_cast<double>(t));
+
+            for (size_t i{}; i < repetitions; ++i) {
+
+                if (gradient(shared) != shared_reference)
+                    ++failures[t];
+
+                if (gradient(own) != own_reference[t])
+                    ++failures[t];
+
+            }
+
+        });
+
+    }
+
+    for (auto& worker : workers)
+        worker.join();
+
+    size_t failed{};
+    for (size_t t{}; t < threads; ++t) {
+
+        if (failures[t])
+            std::cerr << "thread " << t << ": " << failures[t] << " gradients differ from the serial reference\n";
+
+        failed += failures[t];
+
+    }
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+
+}
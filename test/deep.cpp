@@ -0,0 +1,75 @@
+/**
+ * @file    test/deep.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the test of the graphs of very long accumulations.
+ *          Testing y = sum_k sin(c_k x), with c_k = 1 + k % 7, accumulated term by term in a chain of a million terms,
+ *          which is built, differentiated w.r.t. x and destroyed without exhausting the stack,
+ *          and whose value and derivative are compared with the exact ones.
+ * @date    2023-07-29
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+inline constexpr int64_t terms = 1'000'000;
+
+
+// Return whether a computed value is close to the exact one, up to the rounding accumulated over the terms
+bool close(double computed, double exact) {
+
+    return std::abs(computed - exact) <= 1e-9 * terms;
+
+}
+
+
+int main() {
+
+    const double x0 = 0.3;
+
+    double value{}, derivative{};
+    for (int64_t k{}; k < terms; ++k) {
+
+        const double c = 1.0 + k % 7;
+        value += std::sin(c * x0);
+        derivative += c * std::cos(c * x0);
+
+    }
+
+    variable<double> x = x0;
+    double computed_value{}, computed_derivative{};
+
+    {
+
+        variable<double> y = 0.0;
+        for (int64_t k{}; k < terms; ++k)
+            y = y + op::sin((1.0 + k % 7) * x);
+
+        computed_value = val(y);
+        computed_derivative = derivatives(y, wrt(x));
+
+    } // the chain is destroyed here
+
+    if (!close(computed_value, value)) {
+
+        std::cerr << "value of the chain: " << computed_value << ", expected " << value << '\n';
+        return EXIT_FAILURE;
+
+    }
+
+    if (!close(computed_derivative, derivative)) {
+
+        std::cerr << "derivative of the chain: " << computed_derivative << ", expected " << derivative << '\n';
+        return EXIT_FAILURE;
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
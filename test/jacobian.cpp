@@ -0,0 +1,67 @@
+/**
+ * @file    test/jacobian.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the test of the jacobians of vectors of variables of measurements.
+ *          Testing zs = [ x^2, x y, y^2 ] at x = 2 m, y = 3 m, as in docs/math/autodiff.md:
+ *          the jacobian in forward and in reverse mode, and its products with a vector on both sides.
+ * @date    2023-07-25
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::physics;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// Return whether a computed length is equal to the expected one, in meters
+template <typename MEAS_TYPE>
+bool close(const MEAS_TYPE& computed, double expected) {
+
+    return std::abs(computed.value - expected) <= 1e-12 * std::max(1.0, std::abs(expected));
+
+}
+
+
+int main() {
+
+    variable<measurement<base::length>> x = 2.0 * units::m;
+    variable<measurement<base::length>> y = 3.0 * units::m;
+
+    geometry::vector<variable<measurement<base::area>>, 3> zs{x * x, x * y, y * y};
+
+    const std::array<std::array<double, 3>, 2> expected{{{4.0, 3.0, 0.0}, {0.0, 2.0, 6.0}}};
+
+    size_t failed{};
+
+    const auto J = jacobian(zs, wrt(x, y));
+    const auto Jf = forward_jacobian(zs, wrt(x, y));
+    const auto Jr = reverse_jacobian(zs, wrt(x, y));
+
+    // the modes return the tuple of the columns, the jacobian their matrix
+    const std::array<std::array<measurement<base::length>, 3>, 2> forward{std::get<0>(Jf).data, std::get<1>(Jf).data};
+    const std::array<std::array<measurement<base::length>, 3>, 2> reverse{std::get<0>(Jr).data, std::get<1>(Jr).data};
+
+    for (size_t j{}; j < 2; ++j)
+        for (size_t i{}; i < 3; ++i)
+            if (!close(J.data[j].data[i], expected[j][i]) || !close(forward[j][i], expected[j][i]) || !close(reverse[j][i], expected[j][i]))
+                std::cerr << "J(" << i << ", " << j << ") differs from " << expected[j][i] << " m\n", ++failed;
+
+    geometry::vector<double, 3> u{1.0, 0.0, -1.0};
+
+    const auto [du_dx, du_dy] = vjp(zs, u, wrt(x, y));
+    if (!close(du_dx, 4.0) || !close(du_dy, -6.0))
+        std::cerr << "vjp: " << du_dx << ", " << du_dy << ", expected 4 m, -6 m\n", ++failed;
+
+    const auto dz = jvp(zs, wrt(x, y), std::tuple{1.0 * units::m, 0.0 * units::m});
+    for (size_t i{}; i < 3; ++i)
+        if (!close(dz.data[i], expected[0][i]))
+            std::cerr << "jvp(" << i << "): " << dz.data[i] << ", expected " << expected[0][i] << " m^2\n", ++failed;
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+
+}
@@ -0,0 +1,57 @@
+/**
+ * @file    test/primitive.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the test of the primitive nodes on measurements.
+ *          Testing r = hypot(x, y) at x = 3 m, y = 4 m, as in docs/math/autodiff.md, recorded as a single node
+ *          with its fused partial derivatives x / r and y / r, which can not be differentiated twice.
+ * @date    2023-07-26
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::physics;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+// Return whether a computed value is equal to the expected one, up to the rounding
+bool close(double computed, double expected) {
+
+    return std::abs(computed - expected) <= 1e-12 * std::max(1.0, std::abs(expected));
+
+}
+
+
+int main() {
+
+    primitive hypot(
+        [](const auto& x, const auto& y) { return op::sqrt(x * x + y * y); }, 
+        [](const auto& h, const auto& x, const auto& y) { return std::tuple{x / h, y / h}; } // dimensionless
+    ); 
+
+    variable<measurement<base::length>> x = 3.0 * units::m, y = 4.0 * units::m; 
+    variable<measurement<base::length>> r = hypot(x, y); 
+
+    size_t failed{};
+
+    if (!close(val(r).value, 5.0))
+        std::cerr << "r: " << val(r) << ", expected 5 m\n", ++failed;
+
+    const auto [dr_dx, dr_dy] = derivatives(r, wrt(x, y));
+    if (!close(dr_dx.value, 0.6) || !close(dr_dy.value, 0.8))
+        std::cerr << "dr: " << dr_dx << ", " << dr_dy << ", expected 0.6, 0.8\n", ++failed;
+
+    try {
+
+        derivativesx(r, wrt(x, y));
+        std::cerr << "derivativesx through a primitive did not throw\n", ++failed;
+
+    } catch (const std::logic_error&) {}
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+
+}
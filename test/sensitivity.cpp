@@ -0,0 +1,61 @@
+/**
+ * @file    test/sensitivity.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the test of the checkpointed sensitivities of the hamiltonian evolution.
+ *          Testing a mass on a spring, H = p^2 / 2m + k (x - l0)^2 / 2, evolved by rk4 steps up to tmax:
+ *          the derivatives of the final position w.r.t. the initial position and momentum, computed by
+ *          hamiltonian::sensitivity with a few snapshots, are compared with the exact ones of the flow,
+ *          cos(w tmax) and sin(w tmax) / (m w), with w = sqrt(k / m).
+ * @date    2023-07-31
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "scipp"
+
+using namespace scipp;
+using namespace scipp::physics;
+using namespace scipp::math;
+using namespace scipp::math::calculus;
+
+
+inline constexpr size_t steps = 200;
+
+
+int main() {
+
+    measurement<base::mass> m = 2.0 * units::kg;
+    variable<measurement<base::length>> x = 2.0 * units::m;
+    variable<measurement<base::velocity>> v = 0.5 * (units::m / units::s);
+    variable<measurement<base::time>> t = 0.0 * units::s;
+
+    potential_energy<potentials::elastic> V(potentials::elastic(3.0 * (units::N / units::m), 1.0 * units::m));
+    lagrangian L(m, x, v, t, V);
+    hamiltonian H(L);
+
+    const auto tmax = 2.0 * units::s;
+    const auto [dx_dx0, dx_dp0] = H.sensitivity<steps>(tmax, {1.0, 0.0}, 8);
+
+    const double w = std::sqrt(3.0 / 2.0);
+    const double expected_x0 = std::cos(w * 2.0), expected_p0 = std::sin(w * 2.0) / (2.0 * w);
+
+    // the rk4 steps are accurate up to dt^4
+    if (std::abs(dx_dx0 - expected_x0) > 1e-6 || std::abs(dx_dp0 - expected_p0) > 1e-6) {
+
+        std::cerr << "sensitivity: " << dx_dx0 << ", " << dx_dp0 << ", expected " << expected_x0 << ", " << expected_p0 << '\n';
+        return EXIT_FAILURE;
+
+    }
+
+    // the system is not evolved
+    if (val(x).value != 2.0 || val(H.p).value != 1.0) {
+
+        std::cerr << "the phase space has changed: " << val(x) << ", " << val(H.p) << '\n';
+        return EXIT_FAILURE;
+
+    }
+
+    return EXIT_SUCCESS;
+
+}